@@ -0,0 +1,35 @@
+# Configurações gerais
+TEMPLATE = app
+LANGUAGE = C++
+QT += core gui
+CONFIG += console
+CONFIG -= app_bundle
+TARGET = Benchmark.app
+
+# C++ flags
+QMAKE_CXX = g++
+QMAKE_CXXFLAGS_WARN_ON = -Wall
+QMAKE_CXXFLAGS_RELEASE = -std=c++0x -O2 -pthread -ffp-contract=off
+QMAKE_CXXFLAGS_DEBUG = -std=c++0x -O2 -pthread -ffp-contract=off
+
+# Inclusões e bibliotecas
+INCLUDEPATH += include
+LIBS += -pthread
+
+# Diretórios de destino
+OBJECTS_DIR = temp/benchmark
+MOC_DIR = temp/benchmark
+
+# Arquivos fonte (sem widgets: a Viewport e os formulários ficam de fora)
+SOURCES += src/benchmark/*.cpp \
+src/gui/FrameBuffer.cpp \
+src/gui/Iluminador.cpp \
+src/gui/KernelsFragmentos.cpp \
+src/gui/Pixel.cpp \
+src/gui/Renderizador.cpp \
+src/gui/clipping/*.cpp \
+src/gui/rasterizacao/*.cpp \
+src/geometria/*.cpp \
+src/geometria/projecao/*.cpp \
+src/persistencia/*.cpp \
+src/util/*.cpp \
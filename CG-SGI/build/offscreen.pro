@@ -0,0 +1,38 @@
+# Configurações gerais
+TEMPLATE = app
+LANGUAGE = C++
+QT += core gui
+CONFIG += console
+CONFIG -= app_bundle
+TARGET = Offscreen.app
+
+# C++ flags
+QMAKE_CXX = g++
+QMAKE_CXXFLAGS_WARN_ON = -Wall
+QMAKE_CXXFLAGS_RELEASE = -std=c++0x -O2 -pthread -ffp-contract=off
+QMAKE_CXXFLAGS_DEBUG = -std=c++0x -O2 -pthread -ffp-contract=off
+
+# Nível mínimo de log compilado (0: depuração a 4: nenhum)
+DEFINES += NIVEL_LOG_COMPILADO=0
+
+# Inclusões e bibliotecas
+INCLUDEPATH += include
+LIBS += -pthread
+
+# Diretórios de destino
+OBJECTS_DIR = temp/offscreen
+MOC_DIR = temp/offscreen
+
+# Arquivos fonte (sem widgets: a Viewport e os formulários ficam de fora)
+SOURCES += src/offscreen/*.cpp \
+src/gui/FrameBuffer.cpp \
+src/gui/Iluminador.cpp \
+src/gui/KernelsFragmentos.cpp \
+src/gui/Pixel.cpp \
+src/gui/Renderizador.cpp \
+src/gui/clipping/*.cpp \
+src/gui/rasterizacao/*.cpp \
+src/geometria/*.cpp \
+src/geometria/projecao/*.cpp \
+src/persistencia/*.cpp \
+src/util/*.cpp \
@@ -9,12 +9,15 @@ TARGET = SGI.app
 # C++ flags
 QMAKE_CXX = g++
 QMAKE_CXXFLAGS_WARN_ON = -Wall
-QMAKE_CXXFLAGS_RELEASE = -std=c++0x -g
-QMAKE_CXXFLAGS_DEBUG = -std=c++0x -g
+QMAKE_CXXFLAGS_RELEASE = -std=c++0x -g -pthread -ffp-contract=off
+QMAKE_CXXFLAGS_DEBUG = -std=c++0x -g -pthread -ffp-contract=off
+
+# Nível mínimo de log compilado (0: depuração a 4: nenhum)
+DEFINES += NIVEL_LOG_COMPILADO=0
 
 # Inclusões e bibliotecas
 INCLUDEPATH += include
-LIBS +=
+LIBS += -pthread
 
 # Diretórios de destino
 OBJECTS_DIR = temp
@@ -27,11 +30,13 @@ HEADERS  += include/gui/forms/*.h \
 # Arquivos fonte
 SOURCES += src/gui/*.cpp \
 src/gui/clipping/*.cpp \
+src/gui/rasterizacao/*.cpp \
 src/gui/forms/*.cpp \
 src/controle/*.cpp \
 src/geometria/*.cpp \
 src/geometria/projecao/*.cpp \
 src/persistencia/*.cpp \
+src/util/*.cpp \
 
 # Arquivos de formulário
 FORMS    += src/gui/forms/ui/*.ui \
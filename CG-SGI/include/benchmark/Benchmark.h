@@ -0,0 +1,158 @@
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Execução e registro dos casos de benchmark.
+ * Cada caso é aquecido e então repetido até o número de repetições ou o
+ * tempo máximo (no mínimo MINIMO_REPETICOES vezes); cada repetição é
+ * cronometrada isoladamente, e o resultado guarda a mediana e os
+ * percentis das repetições. Os resultados são gravados em JSON e dois
+ * arquivos podem ser comparados para apontar regressões.
+ */
+class Benchmark {
+
+public:
+	/**
+	 * Número mínimo de repetições medidas de cada caso.
+	 */
+	static const unsigned int MINIMO_REPETICOES = 3;
+
+	/**
+	 * Medidas de um caso, em nanossegundos por repetição.
+	 */
+	struct Resultado {
+		std::string nome;
+		unsigned long long operacoes;
+		unsigned int repeticoes;
+		double minimo;
+		double mediana;
+		double media;
+		double p90;
+		double p99;
+		double maximo;
+	};
+
+	/**
+	 * Construtor.
+	 * @param repeticoes número máximo de repetições medidas de cada caso.
+	 * @param tempoMaximo tempo, em segundos, após o qual um caso deixa de
+	 * ser repetido.
+	 * @param filtro prefixo dos nomes dos casos executados (vazio para
+	 * todos).
+	 */
+	Benchmark(const unsigned int repeticoes, const double tempoMaximo,
+			const std::string& filtro);
+
+	/**
+	 * Destrutor.
+	 */
+	virtual ~Benchmark();
+
+	/**
+	 * Verificar se um caso passa pelo filtro, isto é, se o filtro é prefixo
+	 * do seu nome.
+	 * @param nome nome do caso.
+	 * @return true caso o caso seja executado.
+	 */
+	bool isSelecionado(const std::string& nome) const;
+
+	/**
+	 * Verificar se algum caso de um grupo passa pelo filtro, para evitar
+	 * preparações desnecessárias: o filtro pode ser prefixo do grupo ou
+	 * selecionar somente um caso dentro dele.
+	 * @param prefixo prefixo comum aos nomes dos casos do grupo.
+	 * @return true caso algum caso do grupo possa ser executado.
+	 */
+	bool isGrupoSelecionado(const std::string& prefixo) const;
+
+	/**
+	 * Executar e medir um caso.
+	 * @param nome nome do caso, no formato grupo/caso/parâmetro.
+	 * @param operacoes número de operações (objetos, pixels, vértices) de
+	 * cada repetição, para o cálculo da vazão.
+	 * @param caso função medida.
+	 * @param preparar função executada antes de cada repetição, fora da
+	 * medição (opcional).
+	 */
+	void executar(const std::string& nome, const unsigned long long operacoes,
+			const std::function<void()>& caso,
+			const std::function<void()>& preparar = std::function<void()>());
+
+	/**
+	 * Registrar a falha da verificação de um caso, como a divergência entre
+	 * um kernel vetorial e a versão escalar.
+	 * @param nome nome do caso.
+	 * @param mensagem descrição da falha.
+	 */
+	void registrarFalha(const std::string& nome, const std::string& mensagem);
+
+	/**
+	 * Obter o número de falhas registradas.
+	 * @return número de falhas.
+	 */
+	unsigned int getNumFalhas() const;
+
+	/**
+	 * Obter os resultados dos casos executados.
+	 * @return resultados, na ordem de execução.
+	 */
+	const std::vector<Resultado>& getResultados() const;
+
+	/**
+	 * Gravar os resultados em JSON.
+	 * @param caminho caminho do arquivo ("-" para a saída padrão).
+	 * @return false caso o arquivo não possa ser escrito.
+	 */
+	bool gravar(const std::string& caminho) const;
+
+	/**
+	 * Ler os resultados de um arquivo gravado por gravar.
+	 * @param caminho caminho do arquivo.
+	 * @param resultados resultados lidos.
+	 * @return false caso o arquivo não possa ser lido.
+	 */
+	static bool ler(const std::string& caminho,
+			std::vector<Resultado>* resultados);
+
+	/**
+	 * Comparar dois conjuntos de resultados pelas medianas, imprimindo uma
+	 * linha por caso. Um caso regrediu quando a mediana cresce mais que o
+	 * limiar e o mínimo atual também fica acima da mediana de referência,
+	 * para não apontar uma única execução ruidosa. Casos da referência
+	 * ausentes dos resultados atuais (removidos ou renomeados) também são
+	 * falhas; casos novos são apenas listados.
+	 * @param referencia resultados de referência.
+	 * @param atuais resultados atuais.
+	 * @param limiar aumento relativo tolerado (0.1 para 10%).
+	 * @return número de casos que regrediram ou estão ausentes.
+	 */
+	static unsigned int comparar(const std::vector<Resultado>& referencia,
+			const std::vector<Resultado>& atuais, const double limiar);
+
+	/**
+	 * Consumir um valor calculado por um caso, impedindo que o compilador
+	 * elimine o cálculo.
+	 * @param valor valor consumido.
+	 */
+	static void consumir(const double valor);
+
+private:
+	/**
+	 * Obter um percentil (pelo posto mais próximo) de amostras ordenadas.
+	 */
+	static double getPercentil(const std::vector<double>& amostras,
+			const double percentil);
+
+	unsigned int repeticoes;
+	double tempoMaximo;
+	std::string filtro;
+	std::vector<Resultado> resultados;
+	unsigned int numFalhas;
+
+};
+
+#endif /* BENCHMARK_H_ */
@@ -0,0 +1,80 @@
+#ifndef CASOS_H_
+#define CASOS_H_
+
+#include "benchmark/Benchmark.h"
+#include "geometria/Mundo.h"
+
+/**
+ * Casos de benchmark dos caminhos críticos, isolados e de ponta a ponta.
+ * Os casos que usam cenas leem as amostras em samples/, relativas ao
+ * diretório de execução.
+ */
+class Casos {
+
+public:
+	/**
+	 * Leitura dos arquivos OBJ de exemplo.
+	 * @param benchmark executor dos casos.
+	 */
+	static void executarPersistencia(Benchmark* benchmark);
+
+	/**
+	 * Inserção e busca (por nome e por posição) no display file, de 10 a
+	 * 10^6 objetos.
+	 * @param benchmark executor dos casos.
+	 */
+	static void executarDisplayFile(Benchmark* benchmark);
+
+	/**
+	 * Transformação de objetos (ObjetoGeometrico::aplicarTransformacao) e
+	 * projeção da cena pela window.
+	 * @param benchmark executor dos casos.
+	 */
+	static void executarTransformacao(Benchmark* benchmark);
+
+	/**
+	 * Triangulação das facetas das malhas e de um polígono côncavo.
+	 * @param benchmark executor dos casos.
+	 */
+	static void executarTriangulacao(Benchmark* benchmark);
+
+	/**
+	 * Clipping de retas por Cohen-Sutherland e por Liang-Barsky.
+	 * @param benchmark executor dos casos.
+	 */
+	static void executarClipping(Benchmark* benchmark);
+
+	/**
+	 * Rasterização dos triângulos de uma malha em um frame buffer, por
+	 * scanline e por semi-planos, e de retas por Bresenham.
+	 * @param benchmark executor dos casos.
+	 */
+	static void executarRasterizacao(Benchmark* benchmark);
+
+	/**
+	 * Iluminação em lote de um quadro sintético com cada conjunto de
+	 * instruções suportado.
+	 * @param benchmark executor dos casos.
+	 */
+	static void executarIluminacao(Benchmark* benchmark);
+
+	/**
+	 * Renderização completa das cenas de exemplo em várias resoluções.
+	 * @param benchmark executor dos casos.
+	 */
+	static void executarQuadros(Benchmark* benchmark);
+
+private:
+	/**
+	 * Carregar uma cena de exemplo em um mundo e aplicar um zoom.
+	 * @param arquivo caminho da cena.
+	 * @param zoom fator de zoom, como o controle da interface.
+	 * @param mundo mundo que recebe os objetos.
+	 * @return false caso a cena não possa ser lida.
+	 */
+	static bool carregarCena(const String& arquivo, const double zoom,
+			Mundo* mundo);
+
+};
+
+#endif /* CASOS_H_ */
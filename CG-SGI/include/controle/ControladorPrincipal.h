@@ -55,6 +55,11 @@ public:
 	 */
 	void reiniciarVisualizacao();
 
+	/**
+	 * Redesenhar os objetos normalizados sem alterar o mundo.
+	 */
+	void redesenharCena();
+
 	/**
 	 * Definir o tipo de projeção da window.
 	 * @param tipoProjecao tipo de projeção.
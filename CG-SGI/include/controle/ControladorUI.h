@@ -175,6 +175,11 @@ public:
 	 */
 	void reiniciarWindow();
 
+	/**
+	 * Redesenhar a cena atual, após uma mudança nas opções de renderização.
+	 */
+	void redesenharCena();
+
 	void atualizarCena(const QList<ObjetoGeometrico*>& objetos);
 
 protected:
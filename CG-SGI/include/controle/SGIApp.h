@@ -27,6 +27,15 @@ public:
 	 */
 	static int exec();
 
+	/**
+	 * Entregar um evento a um objeto, registrando os eventos de entrada do
+	 * usuário no rastreamento.
+	 * @param destino objeto que recebe o evento.
+	 * @param evento evento entregue.
+	 * @return true caso o evento tenha sido tratado.
+	 */
+	virtual bool notify(QObject* destino, QEvent* evento);
+
 };
 
 #endif /* SGIAPP_H_ */
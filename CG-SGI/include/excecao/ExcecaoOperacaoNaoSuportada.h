@@ -0,0 +1,42 @@
+#ifndef EXCECAOOPERACAONAOSUPORTADA_H_
+#define EXCECAOOPERACAONAOSUPORTADA_H_
+
+#include "excecao/Excecao.h"
+
+/**
+ * Exceção de Operação Não Suportada pelo objeto.
+ */
+class ExcecaoOperacaoNaoSuportada : public Excecao {
+
+public:
+	/**
+	 * Construtor.
+	 * @param objeto nome do objeto.
+	 * @param operacao nome da operação.
+	 */
+	ExcecaoOperacaoNaoSuportada(const String& objeto, const String& operacao) {
+		this->objeto = objeto;
+		this->operacao = operacao;
+	}
+
+	/**
+	 * Destrutor.
+	 */
+	virtual ~ExcecaoOperacaoNaoSuportada() throw() {}
+
+	/**
+	 * Obter a mensagem da exceção como string de C++.
+	 * @return A mensagem correspondente.
+	 */
+	virtual String getMensagem() const {
+		return "O objeto " + this->objeto + " não suporta a operação "
+				+ this->operacao + ".";
+	}
+
+protected:
+	String objeto;
+	String operacao;
+
+};
+
+#endif /* EXCECAOOPERACAONAOSUPORTADA_H_ */
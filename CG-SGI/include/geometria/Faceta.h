@@ -13,6 +13,7 @@ public:
 	ObjetoGeometrico* clonar() const;
 	QList<Ponto> getPontos() const;
 	QList<Ponto*> getPontosObjeto();
+	static Ponto calcularVetorNormal(const QList<Ponto>& pontos);
 
 private:
 	QList<Ponto*> pontos;
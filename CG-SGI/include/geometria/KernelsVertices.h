@@ -0,0 +1,122 @@
+#ifndef KERNELSVERTICES_H_
+#define KERNELSVERTICES_H_
+
+/**
+ * Transformação de vértices em lote, sobre vetores contíguos de
+ * coordenadas x, y e z (estrutura de vetores).
+ *
+ * Há implementações escalar, SSE2 e AVX2, escolhidas em tempo de execução
+ * conforme o processador. Todas produzem resultados idênticos bit a bit:
+ * cada coordenada é x * m[0][j] + y * m[1][j] + z * m[2][j] + m[3][j],
+ * somada nessa ordem e sem operações fundidas. Lotes com pelo menos
+ * MINIMO_PARALELO vértices são divididos em blocos e executados por um
+ * conjunto de threads próprio, criado no primeiro uso.
+ *
+ * As versões em precisão simples operam diretamente sobre o armazenamento
+ * das malhas: as coordenadas são convertidas para precisão dupla, calculadas
+ * como acima e arredondadas somente no resultado.
+ */
+class KernelsVertices {
+
+public:
+	/**
+	 * Conjunto de instruções utilizado pelos kernels.
+	 */
+	enum ConjuntoInstrucoes {
+		ESCALAR, SSE2, AVX2
+	};
+
+	/**
+	 * Número mínimo de vértices para dividir um lote entre threads.
+	 */
+	static const unsigned int MINIMO_PARALELO = 1 << 16;
+
+	/**
+	 * Número de vértices de cada bloco de um lote paralelo.
+	 */
+	static const unsigned int TAMANHO_BLOCO = 1 << 14;
+
+	/**
+	 * Detectar o conjunto de instruções mais amplo suportado pelo processador.
+	 * @return conjunto de instruções suportado.
+	 */
+	static ConjuntoInstrucoes detectarSuporte();
+
+	/**
+	 * Obter o conjunto de instruções em uso.
+	 * @return conjunto de instruções.
+	 */
+	static ConjuntoInstrucoes getConjuntoInstrucoes();
+
+	/**
+	 * Definir o conjunto de instruções em uso, limitado ao suportado pelo
+	 * processador.
+	 * @param conjunto conjunto de instruções desejado.
+	 */
+	static void setConjuntoInstrucoes(const ConjuntoInstrucoes conjunto);
+
+	/**
+	 * Verificar se os lotes grandes são divididos entre threads.
+	 * @return true caso o paralelismo esteja habilitado.
+	 */
+	static bool isParalelo();
+
+	/**
+	 * Habilitar ou desabilitar a divisão dos lotes grandes entre threads.
+	 * @param paralelo true para habilitar (padrão).
+	 */
+	static void setParalelo(const bool paralelo);
+
+	/**
+	 * Aplicar uma transformação afim aos vértices (w = 1).
+	 * @param matriz matriz de transformação, com vetores linha.
+	 * @param x coordenadas x, substituídas pelas transformadas.
+	 * @param y coordenadas y, substituídas pelas transformadas.
+	 * @param z coordenadas z, substituídas pelas transformadas.
+	 * @param n número de vértices.
+	 */
+	static void transformar(const double matriz[4][4], double* const x,
+			double* const y, double* const z, const unsigned int n);
+
+	/**
+	 * Aplicar uma projeção aos vértices: x e y são divididos pela coordenada
+	 * w e z mantém a profundidade, sem divisão.
+	 * @param matriz matriz de projeção, com o divisor na coluna w.
+	 * @param x coordenadas x, substituídas pelas projetadas.
+	 * @param y coordenadas y, substituídas pelas projetadas.
+	 * @param z coordenadas z, substituídas pelas projetadas.
+	 * @param n número de vértices.
+	 */
+	static void projetar(const double matriz[4][4], double* const x,
+			double* const y, double* const z, const unsigned int n);
+
+	/**
+	 * Aplicar uma transformação afim a vértices em precisão simples (w = 1).
+	 * @param matriz matriz de transformação, com vetores linha.
+	 * @param x coordenadas x, substituídas pelas transformadas.
+	 * @param y coordenadas y, substituídas pelas transformadas.
+	 * @param z coordenadas z, substituídas pelas transformadas.
+	 * @param n número de vértices.
+	 */
+	static void transformar(const double matriz[4][4], float* const x,
+			float* const y, float* const z, const unsigned int n);
+
+	/**
+	 * Aplicar uma projeção a vértices em precisão simples, como em
+	 * projetar(const double[4][4], double*, double*, double*, unsigned int).
+	 * @param matriz matriz de projeção, com o divisor na coluna w.
+	 * @param x coordenadas x, substituídas pelas projetadas.
+	 * @param y coordenadas y, substituídas pelas projetadas.
+	 * @param z coordenadas z, substituídas pelas projetadas.
+	 * @param n número de vértices.
+	 */
+	static void projetar(const double matriz[4][4], float* const x,
+			float* const y, float* const z, const unsigned int n);
+
+private:
+	static ConjuntoInstrucoes conjunto;
+	static bool paralelo;
+
+};
+
+#endif /* KERNELSVERTICES_H_ */
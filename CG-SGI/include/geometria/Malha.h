@@ -0,0 +1,202 @@
+#ifndef MALHA_H_
+#define MALHA_H_
+
+#include <QtCore/qlist.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qvector.h>
+
+#include "geometria/Faceta.h"
+
+/**
+ * Malha poligonal indexada, armazenada em vetores contíguos: as posições
+ * dos vértices em precisão simples (as coordenadas x de todos os vértices,
+ * seguidas das y e das z, 12 bytes por vértice), os índices dos vértices de todas as facetas em sequência, o
+ * início de cada faceta nessa sequência e o material de cada faceta, que
+ * indexa a tabela de cores. Normais, áreas, triangulações e arestas são
+ * derivadas da geometria e guardadas nos mesmos moldes.
+ *
+ * Os vetores ficam em dois blocos compartilhados entre as cópias da malha,
+ * com cópia na escrita: a topologia (facetas, materiais, triangulações e
+ * arestas), que não muda após a construção, e os atributos (posições e
+ * normais), copiados somente quando uma cópia é transformada. Copiar uma
+ * malha custa o mesmo qualquer que seja o seu tamanho, e uma malha projetada
+ * continua compartilhando a topologia com a original.
+ */
+class Malha {
+
+public:
+	/**
+	 * Construtor de uma malha vazia.
+	 */
+	Malha();
+
+	/**
+	 * Construtor. Os pontos são copiados para o vetor de posições, na ordem
+	 * da lista; as facetas devem referenciar somente pontos da lista.
+	 * @param pontos vértices da malha.
+	 * @param facetas facetas da malha, cada uma com a sua cor.
+	 */
+	Malha(const QList<Ponto*>& pontos, const QList<Faceta>& facetas);
+
+	/**
+	 * Obter o número de vértices.
+	 * @return número de vértices.
+	 */
+	int getNumVertices() const;
+
+	/**
+	 * Obter o número de facetas.
+	 * @return número de facetas.
+	 */
+	int getNumFacetas() const;
+
+	/**
+	 * Obter um vértice.
+	 * @param vertice índice do vértice.
+	 * @return cópia do vértice.
+	 */
+	Ponto getVertice(const int vertice) const;
+
+	/**
+	 * Obter os vértices de uma faceta.
+	 * @param faceta índice da faceta.
+	 * @return cópia dos vértices, em ordem.
+	 */
+	QList<Ponto> getPontosFaceta(const int faceta) const;
+
+	/**
+	 * Obter os índices dos vértices de uma faceta.
+	 * @param faceta índice da faceta.
+	 * @return índices dos vértices, em ordem.
+	 */
+	QVector<int> getIndicesFaceta(const int faceta) const;
+
+	/**
+	 * Obter a cor do material de uma faceta.
+	 * @param faceta índice da faceta.
+	 * @return cor da faceta.
+	 */
+	QColor getCor(const int faceta) const;
+
+	/**
+	 * Obter a normal unitária de uma faceta.
+	 * @param faceta índice da faceta.
+	 * @return normal da faceta.
+	 */
+	Ponto getNormal(const int faceta) const;
+
+	/**
+	 * Obter a área de uma faceta.
+	 * @param faceta índice da faceta.
+	 * @return área da faceta.
+	 */
+	double getArea(const int faceta) const;
+
+	/**
+	 * Obter as normais dos vértices de uma faceta.
+	 * @param faceta índice da faceta.
+	 * @return normais na ordem dos vértices da faceta; vazia caso a malha
+	 * não possua normais nos vértices.
+	 */
+	QList<Ponto> getNormaisVertices(const int faceta) const;
+
+	/**
+	 * Obter a triangulação de uma faceta.
+	 * @param faceta índice da faceta.
+	 * @return índices dos vértices (na ordem da faceta), três por triângulo.
+	 */
+	QVector<int> getTriangulacao(const int faceta) const;
+
+	/**
+	 * Obter as arestas únicas da malha.
+	 * @return índices dos vértices, dois por aresta.
+	 */
+	QVector<int> getArestas() const;
+
+	/**
+	 * Verificar se a malha é fechada, isto é, se cada aresta é compartilhada
+	 * por exatamente duas facetas.
+	 * @return true caso a malha seja fechada.
+	 */
+	bool isFechada() const;
+
+	/**
+	 * Aplicar uma transformação afim aos vértices, levando as normais pela
+	 * matriz de cofatores da parte linear.
+	 * @param matriz matriz de transformação.
+	 */
+	void aplicarTransformacao(const double matriz[4][4]);
+
+	/**
+	 * Aplicar uma projeção aos vértices. As normais devem ser recalculadas.
+	 * @param matriz matriz de projeção em coordenadas homogêneas.
+	 */
+	void aplicarProjecao(const double matriz[4][4]);
+
+	/**
+	 * Recalcular as normais e as áreas das facetas e, opcionalmente, as
+	 * normais dos vértices (média das normais das facetas adjacentes,
+	 * ponderada pela área).
+	 * @param normaisVertices true para calcular as normais dos vértices.
+	 */
+	void atualizarNormais(const bool normaisVertices);
+
+	/**
+	 * Triangular as facetas no plano de cada uma.
+	 */
+	void atualizarTriangulacoes();
+
+	/**
+	 * Extrair as arestas únicas das facetas.
+	 */
+	void atualizarArestas();
+
+	/**
+	 * Obter a memória ocupada pelos vetores da malha, incluindo os
+	 * compartilhados com outras cópias.
+	 * @return número de bytes.
+	 */
+	unsigned long getTamanhoMemoria() const;
+
+private:
+	/**
+	 * Topologia da malha.
+	 */
+	struct Topologia : public QSharedData {
+		QVector<int> indices;
+		QVector<int> inicios;
+		QVector<int> materiais;
+		QVector<QColor> cores;
+		QVector<int> triangulos;
+		QVector<int> iniciosTriangulos;
+		QVector<int> arestas;
+	};
+
+	/**
+	 * Atributos dos vértices e das facetas.
+	 */
+	struct Atributos : public QSharedData {
+		QVector<float> posicoes;
+		QVector<float> normais;
+		QVector<float> areas;
+		QVector<float> normaisVertices;
+	};
+
+	/**
+	 * Obter a chave de cada aresta de faceta (índices menor e maior), uma
+	 * por lado de faceta, em ordem crescente.
+	 */
+	QVector<long long> chavesArestas() const;
+
+	/**
+	 * Transformar os vértices em lote, diretamente sobre o vetor de
+	 * posições.
+	 */
+	void transformarVertices(const double matriz[4][4], const bool projecao);
+
+	QSharedDataPointer<Topologia> topologia;
+	QSharedDataPointer<Atributos> atributos;
+
+};
+
+#endif /* MALHA_H_ */
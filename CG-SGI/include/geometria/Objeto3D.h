@@ -1,13 +1,12 @@
 #ifndef OBJETO3D_H_
 #define OBJETO3D_H_
 
-#include <QtCore/qmap.h>
-
-#include "geometria/Ponto.h"
-#include "geometria/Faceta.h"
+#include "excecao/ExcecaoOperacaoNaoSuportada.h"
+#include "geometria/Malha.h"
 
 /*
- * Objeto tridimensional.
+ * Objeto tridimensional. A geometria é guardada em uma malha indexada
+ * (Malha); o objeto acrescenta o nome, a cor e as opções de renderização.
  */
 class Objeto3D : public ObjetoGeometrico {
 
@@ -26,8 +25,8 @@ public:
 	/**
 	 * Construtor.
 	 * @param nome nome do objeto.
-	 * @param pontos pontos do objeto.
-	 * @param arestas arestas do objeto.
+	 * @param pontos pontos do objeto, copiados para a malha.
+	 * @param facetas facetas do objeto.
 	 */
 	Objeto3D(const String& nome, const QList<Ponto*>& pontos,
 			const QList<Faceta>& facetas);
@@ -57,16 +56,91 @@ public:
 	QList<Ponto> getPontos() const;
 
 	/**
-	 * Obter os pontos do objeto.
-	 * @return lista de pontos.
+	 * Não suportado: os vértices não são objetos Ponto, e sim posições da
+	 * malha.
+	 * @throws ExcecaoOperacaoNaoSuportada sempre.
 	 */
 	QList<Ponto*> getPontosObjeto();
 
 	/**
-	 * Obter as arestas do objeto.
-	 * @return lista com a cópia das arestas.
+	 * Obter a malha do objeto.
+	 * @return malha com os vértices e as facetas.
+	 */
+	const Malha& getMalha() const;
+
+	/**
+	 * Aplicar uma transformação afim ao objeto, levando as normais pela matriz
+	 * de cofatores da parte linear.
+	 * @param matriz matriz de transformação.
+	 */
+	void aplicarTransformacao(const double matriz[4][4]);
+
+	/**
+	 * Aplicar uma projeção ao objeto, atualizando as normais.
+	 * @param matriz matriz de projeção em coordenadas homogêneas.
+	 */
+	void aplicarProjecao(const double matriz[4][4]);
+
+	/**
+	 * Recalcular as normais das facetas e, se o objeto for suavizado, as
+	 * normais dos vértices (média das normais das facetas adjacentes,
+	 * ponderada pela área).
+	 */
+	void atualizarNormais();
+
+	/**
+	 * Triangular as facetas. A triangulação é feita no plano de cada faceta e
+	 * continua válida após transformações afins e projeções, devendo ser
+	 * refeita somente quando os vértices das facetas mudam.
+	 */
+	void atualizarTriangulacoes();
+
+	/**
+	 * Extrair as arestas únicas das facetas: uma aresta compartilhada por
+	 * facetas vizinhas é registrada uma única vez. Deve ser refeita somente
+	 * quando os vértices das facetas mudam.
+	 */
+	void atualizarArestas();
+
+	/**
+	 * Obter as arestas únicas do objeto.
+	 * @return índices dos pontos (na ordem de getPontos), dois por aresta.
+	 */
+	QVector<int> getArestas() const;
+
+	/**
+	 * Verificar se o objeto possui normais suaves nos vértices.
+	 * @return true caso as normais dos vértices sejam calculadas.
+	 */
+	bool isSuavizado() const;
+
+	/**
+	 * Definir se o objeto possui normais suaves nos vértices.
+	 * @param suavizado true para calcular as normais dos vértices.
+	 */
+	void setSuavizado(const bool suavizado);
+
+	/**
+	 * Verificar se a malha é fechada, isto é, se cada aresta é compartilhada
+	 * por exatamente duas facetas.
+	 * @return true caso a malha seja fechada.
+	 */
+	bool isFechado() const;
+
+	/**
+	 * Verificar se as facetas voltadas para trás são descartadas antes da
+	 * rasterização.
+	 * @return true caso as faces traseiras sejam descartadas.
+	 */
+	bool isDescarteFacesTraseiras() const;
+
+	/**
+	 * Definir se as facetas voltadas para trás são descartadas antes da
+	 * rasterização. Por padrão somente malhas fechadas são descartadas, já
+	 * que o interior de malhas abertas pode ficar visível.
+	 * @param descarte true para descartar as faces traseiras.
 	 */
-	QList<Faceta> getFacetas() const;
+	void setDescarteFacesTraseiras(const bool descarte);
 
 	/**
 	 * Converter o objeto em string.
@@ -75,8 +149,9 @@ public:
 	const String toString() const;
 
 private:
-	QList<Ponto*> pontos;
-	QList<Faceta> facetas;
+	Malha malha;
+	bool suavizado;
+	bool descarteFacesTraseiras;
 
 };
 
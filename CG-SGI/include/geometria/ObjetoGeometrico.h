@@ -80,7 +80,11 @@ public:
 	virtual QList<Ponto> getPontos() const = 0;
 
 	/**
-	 * Obter os pontos do objeto.
+	 * Obter os pontos do objeto, que podem ser alterados diretamente (seguido
+	 * de marcarAlteracao). Objetos guardados em malha (Objeto3D) não possuem
+	 * objetos Ponto e lançam ExcecaoOperacaoNaoSuportada: devem ser tratados
+	 * pelo tipo, com getPontos para leitura e as transformações para
+	 * alteração.
 	 * @return lista de pontos.
 	 */
 	virtual QList<Ponto*> getPontosObjeto() = 0;
@@ -127,6 +131,21 @@ public:
 	 */
 	void setCor(const QColor& cor);
 
+	/**
+	 * Obter a revisão do objeto. A revisão muda a cada alteração e é
+	 * herdada pelas cópias, de modo que dois objetos com a mesma revisão têm
+	 * o mesmo conteúdo.
+	 * @return número da revisão.
+	 */
+	unsigned long long getRevisao() const;
+
+	/**
+	 * Registrar uma alteração do objeto, gerando uma nova revisão. As
+	 * transformações e setCor já o fazem; deve ser chamado após alterar
+	 * diretamente os pontos obtidos por getPontosObjeto.
+	 */
+	void marcarAlteracao();
+
 	/**
 	 * Operador de stream de saída.
 	 * @param out stream de saída.
@@ -187,10 +206,19 @@ public:
 	 */
 	virtual void aplicarTransformacao(const double matriz[4][4]);
 
+	/**
+	 * Aplicar uma projeção ao objeto em uma única passada pelos pontos. A
+	 * coluna w da matriz é o divisor da perspectiva, que divide somente x e
+	 * y: z mantém a profundidade na visualização.
+	 * @param matriz matriz de projeção em coordenadas homogêneas.
+	 */
+	virtual void aplicarProjecao(const double matriz[4][4]);
+
 protected:
 	String nome;
 	Tipo tipo;
 	QColor cor;
+	unsigned long long revisao;
 
 };
 
@@ -1,6 +1,8 @@
 #ifndef POLIGONO_H_
 #define POLIGONO_H_
 
+#include <QtCore/qvector.h>
+
 #include "geometria/Ponto.h"
 
 /**
@@ -53,11 +55,32 @@ public:
 	QList<Ponto> getPontos() const;
 
 	/**
-	 * Obter os pontos do objeto.
+	 * Obter os pontos do objeto. Como eles podem ser alterados, a
+	 * triangulação é refeita no seu próximo uso.
 	 * @return lista de pontos.
 	 */
 	QList<Ponto*> getPontosObjeto();
 
+	/**
+	 * Obter a triangulação do polígono, calculada na construção e refeita
+	 * somente após a alteração direta dos pontos. Transformações afins
+	 * preservam a triangulação.
+	 * @return índices dos pontos, três por triângulo.
+	 */
+	QVector<int> getTriangulacao() const;
+
+	/**
+	 * Aplicar uma transformação ao objeto, mantendo a triangulação.
+	 * @param matriz matriz de transformação.
+	 */
+	void aplicarTransformacao(const double matriz[4][4]);
+
+	/**
+	 * Aplicar uma projeção ao objeto, mantendo a triangulação.
+	 * @param matriz matriz de projeção em coordenadas homogêneas.
+	 */
+	void aplicarProjecao(const double matriz[4][4]);
+
 	/**
 	 * Converter o objeto em string.
 	 * @return string representando o objeto.
@@ -65,7 +88,14 @@ public:
 	const String toString() const;
 
 private:
+	/**
+	 * Triangular os pontos do polígono.
+	 */
+	void triangular() const;
+
 	QList<Ponto> pontos;
+	mutable QVector<int> triangulacao;
+	mutable bool triangulacaoPendente;
 
 };
 
@@ -46,6 +46,12 @@ public:
 	 */
 	void aplicarTransformacao(const double matriz[4][4]);
 
+	/**
+	 * Aplicar uma projeção ao objeto.
+	 * @param matriz matriz de projeção em coordenadas homogêneas.
+	 */
+	void aplicarProjecao(const double matriz[4][4]);
+
 	virtual QList<QList<Ponto>> getPontosParametricos() const = 0;
 
 protected:
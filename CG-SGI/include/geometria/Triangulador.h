@@ -0,0 +1,84 @@
+#ifndef TRIANGULADOR_H_
+#define TRIANGULADOR_H_
+
+#include <QtCore/qlist.h>
+#include <QtCore/qvector.h>
+
+#include "geometria/Ponto.h"
+
+/**
+ * Triangulação de polígonos simples (convexos ou côncavos) em O(n log n).
+ * O polígono é projetado no plano coordenado mais próximo do seu plano e
+ * particionado em peças monótonas em y por uma varredura; cada peça é então
+ * triangulada em tempo linear. Como a triangulação é feita no plano do
+ * próprio polígono, ela continua válida após qualquer transformação afim ou
+ * projeção, e pode ser guardada junto com os vértices.
+ */
+class Triangulador {
+
+public:
+	/**
+	 * Triangular um polígono.
+	 * @param pontos vértices do polígono, em ordem.
+	 * @return índices dos vértices, três por triângulo, na orientação do
+	 * polígono. Vazio caso o polígono tenha menos de três vértices.
+	 */
+	static QVector<int> triangular(const QList<Ponto>& pontos);
+
+private:
+	/**
+	 * Vértice projetado no plano do polígono.
+	 */
+	struct Vertice {
+		double x;
+		double y;
+		int indice;
+	};
+
+	/**
+	 * Ordenação das arestas cruzadas pela linha de varredura.
+	 */
+	struct ComparadorArestas;
+
+	/**
+	 * Verificar se o vértice a está acima do vértice b na varredura
+	 * (y maior ou, em caso de empate, x menor).
+	 */
+	static bool acima(const Vertice& a, const Vertice& b);
+
+	/**
+	 * Produto vetorial (b - a) x (c - a).
+	 */
+	static double orientacao(const Vertice& a, const Vertice& b,
+			const Vertice& c);
+
+	/**
+	 * Particionar o polígono em peças monótonas em y.
+	 * @param vertices vértices em sentido anti-horário.
+	 * @return diagonais, dois índices (em vertices) por diagonal.
+	 */
+	static QVector<int> particionarMonotono(const QVector<Vertice>& vertices);
+
+	/**
+	 * Extrair as faces delimitadas pelas arestas do polígono e pelas
+	 * diagonais.
+	 * @param vertices vértices em sentido anti-horário.
+	 * @param diagonais diagonais da partição.
+	 * @return faces, cada uma como a lista de seus vértices em sentido
+	 * anti-horário.
+	 */
+	static QVector<QVector<int> > extrairFaces(
+			const QVector<Vertice>& vertices, const QVector<int>& diagonais);
+
+	/**
+	 * Triangular uma peça monótona em y em tempo linear.
+	 * @param vertices vértices do polígono.
+	 * @param face vértices da peça em sentido anti-horário.
+	 * @param triangulos triângulos gerados (índices em vertices).
+	 */
+	static void triangularMonotono(const QVector<Vertice>& vertices,
+			const QVector<int>& face, QVector<int>* triangulos);
+
+};
+
+#endif /* TRIANGULADOR_H_ */
@@ -3,11 +3,19 @@
 
 #include "geometria/DisplayFile.h"
 #include "geometria/Ponto.h"
+#include "geometria/projecao/Camera.h"
 #include "geometria/projecao/ProjetorParalelo.h"
 #include "geometria/projecao/ProjetorPerspectiva.h"
 
 /**
  * Janela de visualização do mundo.
+ * Mantém os objetos normalizados (projetados e nas coordenadas da window)
+ * e, para cada um, as revisões do objeto e da window com que foi gerado: a
+ * atualização do display file reprojeta somente os objetos alterados depois
+ * de uma transformação, e todos eles, a partir das próprias cópias, depois
+ * de uma mudança da visualização. A revisão da window muda com qualquer
+ * transformação ou troca do projetor, e a câmera, que projeta e normaliza
+ * os objetos com uma única matriz, é remontada somente quando ela muda.
  */
 class Window : public ObjetoGeometrico {
 
@@ -18,7 +26,7 @@ public:
 	Window();
 
 	/**
-	 * Construtor.
+	 * Construtor. Os objetos normalizados não são copiados.
 	 * @param window objeto a ser copiado.
 	 */
 	Window(const Window& window);
@@ -37,7 +45,8 @@ public:
 	virtual ~Window();
 
 	/**
-	 * Operador de atribuição.
+	 * Operador de atribuição. Copia somente a visualização: os objetos
+	 * normalizados são mantidos e reprojetados na próxima atualização.
 	 * @param window objeto a ser copiado.
 	 * @return window copiada.
 	 */
@@ -100,13 +109,15 @@ public:
 	Ponto getCentroProjecao() const;
 
 	/**
-	 * Atualizar lista de objetos da Window.
+	 * Atualizar lista de objetos da Window, reprojetando somente os objetos
+	 * cuja revisão ou a da window mudou desde a última atualização.
 	 * @param displayFile lista de objetos nas coordenadas do mundo.
 	 */
 	void atualizarDisplayFile(const DisplayFile& displayFile);
 
 	/**
-	 * Atualizar objeto ou inserí-lo caso não exista.
+	 * Atualizar objeto ou inserí-lo caso não exista. Nada é feito caso o
+	 * objeto normalizado esteja atualizado.
 	 * @param obj objeto geométrico a ser atualizado.
 	 */
 	void atualizarObjeto(ObjetoGeometrico* const obj);
@@ -135,12 +146,36 @@ public:
 	void setTipoProjecao(const Projetor::TipoProjecao& tipoProjecao);
 
 protected:
+	/**
+	 * Revisões com que um objeto normalizado foi gerado.
+	 */
+	struct Revisoes {
+		unsigned long long objeto;
+		unsigned long long window;
+	};
+
+	/**
+	 * Copiar as coordenadas e os atributos de um objeto do mundo para o
+	 * objeto normalizado correspondente, sem alocar um novo objeto.
+	 * @param normalizado objeto normalizado.
+	 * @param obj objeto nas coordenadas do mundo.
+	 * @return false caso os objetos não tenham o mesmo tipo e número de
+	 * pontos.
+	 */
+	bool restaurarObjeto(ObjetoGeometrico* const normalizado,
+			ObjetoGeometrico* const obj) const;
+
 	/**
 	 * Obter os pontos do objeto.
 	 * @return lista de pontos.
 	 */
 	QList<Ponto*> getPontosObjeto();
 
+	/**
+	 * Remontar a câmera caso a window tenha mudado desde a última montagem.
+	 */
+	void atualizarCamera();
+
 	/**
 	 * Obter o ângulo do View Up Vector com o eixo Y.
 	 * @return o ângulo em radianos.
@@ -165,7 +200,10 @@ protected:
 	Ponto viewRightVector;
 	Ponto vpnVector;
 	DisplayFile displayFileNormalizado;
+	QMap<String, Revisoes> revisoesNormalizadas;
 	Projetor* projetor;
+	Camera camera;
+	unsigned long long revisaoCamera;
 
 };
 
@@ -0,0 +1,44 @@
+#ifndef CAMERA_H_
+#define CAMERA_H_
+
+class ObjetoGeometrico;
+
+/**
+ * Câmera da window: combina as matrizes de visualização, projeção e
+ * normalização em uma única matriz, montada uma vez a cada mudança da
+ * visualização, de modo que cada ponto é projetado e normalizado com uma
+ * única multiplicação seguida da divisão da perspectiva.
+ */
+class Camera {
+
+public:
+	/**
+	 * Construtor. A câmera começa com a matriz identidade.
+	 */
+	Camera();
+
+	/**
+	 * Destrutor.
+	 */
+	virtual ~Camera();
+
+	/**
+	 * Combinar a projeção e a normalização.
+	 * @param projecao matriz de visualização e projeção, com o divisor da
+	 * perspectiva na coluna w.
+	 * @param normalizacao matriz de normalização, que não altera w.
+	 */
+	void montar(const double projecao[4][4], const double normalizacao[4][4]);
+
+	/**
+	 * Projetar e normalizar um objeto nas coordenadas do mundo.
+	 * @param objeto objeto a ser projetado.
+	 */
+	void projetarObjeto(ObjetoGeometrico* const objeto) const;
+
+private:
+	double matriz[4][4];
+
+};
+
+#endif /* CAMERA_H_ */
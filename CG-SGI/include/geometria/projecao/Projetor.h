@@ -1,7 +1,7 @@
 #ifndef PROJETOR_H_
 #define PROJETOR_H_
 
-class ObjetoGeometrico;
+class Ponto;
 class Window;
 
 /**
@@ -37,12 +37,23 @@ public:
 	TipoProjecao getTipo() const;
 
 	/**
-	 * Projetar objeto geométrico na window.
-	 * @param objeto objeto a ser projetado.
+	 * Montar a matriz que leva as coordenadas do mundo ao plano de projeção
+	 * da window, em coordenadas homogêneas: a coluna w é o divisor da
+	 * perspectiva, aplicado somente a x e y.
+	 * @param matriz matriz de projeção.
 	 */
-	virtual void projetarObjeto(ObjetoGeometrico* const objeto) const = 0;
+	virtual void montarMatriz(double matriz[4][4]) const = 0;
 
 protected:
+	/**
+	 * Montar a matriz de visualização: translada a origem dada para o
+	 * centro do sistema e alinha o VPN da window ao eixo z.
+	 * @param origem origem do sistema de visualização.
+	 * @param matriz matriz de visualização.
+	 */
+	void montarMatrizVisualizacao(const Ponto& origem,
+			double matriz[4][4]) const;
+
 	Window* window;
 
 private:
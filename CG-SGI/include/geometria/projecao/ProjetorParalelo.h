@@ -23,10 +23,10 @@ public:
 	virtual ~ProjetorParalelo();
 
 	/**
-	 * Projetar objeto geométrico na window.
-	 * @param objeto objeto a ser projetado.
+	 * Montar a matriz de projeção da window.
+	 * @param matriz matriz de projeção.
 	 */
-	void projetarObjeto(ObjetoGeometrico* const objeto) const;
+	void montarMatriz(double matriz[4][4]) const;
 
 };
 
@@ -0,0 +1,69 @@
+#ifndef DESTINOFRAGMENTOS_H_
+#define DESTINOFRAGMENTOS_H_
+
+/**
+ * Destino dos fragmentos gerados pela rasterização.
+ * Os fragmentos são entregues diretamente ao destino (tipicamente o buffer
+ * de profundidade), sem listas intermediárias de pixels.
+ */
+class DestinoFragmentos {
+
+public:
+	/**
+	 * Destrutor.
+	 */
+	virtual ~DestinoFragmentos() {}
+
+	/**
+	 * Escrever um fragmento isolado.
+	 * @param x coordenada x do pixel.
+	 * @param y coordenada y do pixel.
+	 * @param z profundidade do fragmento.
+	 * @param faceta identificador da faceta do fragmento.
+	 * @param nX componente x da normal.
+	 * @param nY componente y da normal.
+	 * @param nZ componente z da normal.
+	 * @return true caso o fragmento tenha passado no teste de profundidade.
+	 */
+	virtual bool escreverFragmento(const int x, const int y, const float z,
+			const unsigned int faceta, const float nX, const float nY,
+			const float nZ) = 0;
+
+	/**
+	 * Escrever uma sequência horizontal de fragmentos (span).
+	 * @param y linha do span.
+	 * @param xInicial primeira coluna do span.
+	 * @param xFinal última coluna do span (inclusive).
+	 * @param z profundidade na primeira coluna.
+	 * @param incrementoZ variação da profundidade por coluna.
+	 * @param faceta identificador da faceta dos fragmentos.
+	 * @param nX componente x da normal.
+	 * @param nY componente y da normal.
+	 * @param nZ componente z da normal.
+	 */
+	virtual void escreverSpan(const int y, const int xInicial, const int xFinal,
+			const double z, const double incrementoZ,
+			const unsigned int faceta, const float nX, const float nY,
+			const float nZ) = 0;
+
+	/**
+	 * Escrever os fragmentos cobertos de um grupo de pixels consecutivos.
+	 * @param y linha do grupo.
+	 * @param x primeira coluna do grupo.
+	 * @param mascara pixels cobertos, com o bit k correspondendo à coluna x + k
+	 * (até KernelsFragmentos::LARGURA_GRUPO colunas).
+	 * @param z profundidade na primeira coluna.
+	 * @param incrementoZ variação da profundidade por coluna.
+	 * @param faceta identificador da faceta dos fragmentos.
+	 * @param nX componente x da normal.
+	 * @param nY componente y da normal.
+	 * @param nZ componente z da normal.
+	 */
+	virtual void escreverMascara(const int y, const int x,
+			const unsigned int mascara, const double z, const double incrementoZ,
+			const unsigned int faceta, const float nX, const float nY,
+			const float nZ) = 0;
+
+};
+
+#endif /* DESTINOFRAGMENTOS_H_ */
@@ -0,0 +1,254 @@
+#ifndef FRAMEBUFFER_H_
+#define FRAMEBUFFER_H_
+
+#include <QtCore/qrect.h>
+
+#include "gui/DestinoFragmentos.h"
+#include "gui/KernelsFragmentos.h"
+
+/**
+ * Buffer de quadro da viewport (G-buffer).
+ * Mantém planos contíguos (ordem de linhas) de profundidade, identificador da
+ * faceta (que indexa a tabela de materiais do renderizador) e, opcionalmente,
+ * normal compactada em 8 bits por componente. A cor final é calculada depois,
+ * somente para os pixels cobertos.
+ * Junto da profundidade é mantido um nível grosseiro (hierarquia Z), com as
+ * profundidades mínima e máxima de cada bloco de pixels, que permite
+ * descartar geometria oculta sem percorrer os pixels. Cada bloco também conta
+ * os fragmentos testados e os aprovados no teste de profundidade; como os
+ * blocos pertencem a um único tile, as contagens não exigem sincronização.
+ */
+class FrameBuffer : public DestinoFragmentos {
+
+public:
+	/**
+	 * Identificador dos pixels não cobertos por nenhuma faceta.
+	 */
+	static const unsigned int NENHUMA_FACETA = 0xFFFFFFFF;
+
+	/**
+	 * Lado, em pixels, dos blocos da hierarquia de profundidade.
+	 */
+	static const int LADO_BLOCO = 8;
+
+	/**
+	 * Construtor.
+	 * @param largura largura do buffer em pixels.
+	 * @param altura altura do buffer em pixels.
+	 * @param comNormais true para alocar o plano de normais.
+	 */
+	FrameBuffer(const unsigned int largura, const unsigned int altura,
+			const bool comNormais = true);
+
+	/**
+	 * Destrutor.
+	 */
+	virtual ~FrameBuffer();
+
+	/**
+	 * Limpar o buffer: profundidade infinita, nenhuma faceta e normal (0, 0, -1).
+	 */
+	void limpar();
+
+	/**
+	 * Limpar somente uma região do buffer.
+	 * @param area retângulo a ser limpo, contido no buffer.
+	 */
+	void limpar(const QRect& area);
+
+	/**
+	 * Escrever um fragmento, caso passe no teste de profundidade.
+	 * @param x coordenada x do pixel.
+	 * @param y coordenada y do pixel.
+	 * @param z profundidade do fragmento.
+	 * @param faceta identificador da faceta do fragmento.
+	 * @param nX componente x da normal.
+	 * @param nY componente y da normal.
+	 * @param nZ componente z da normal.
+	 * @return true caso o fragmento tenha sido escrito.
+	 */
+	bool escreverFragmento(const int x, const int y, const float z,
+			const unsigned int faceta, const float nX, const float nY,
+			const float nZ);
+
+	/**
+	 * Escrever um span, testando a profundidade de cada fragmento.
+	 * @param y linha do span.
+	 * @param xInicial primeira coluna do span.
+	 * @param xFinal última coluna do span (inclusive).
+	 * @param z profundidade na primeira coluna.
+	 * @param incrementoZ variação da profundidade por coluna.
+	 * @param faceta identificador da faceta dos fragmentos.
+	 * @param nX componente x da normal.
+	 * @param nY componente y da normal.
+	 * @param nZ componente z da normal.
+	 */
+	void escreverSpan(const int y, const int xInicial, const int xFinal,
+			const double z, const double incrementoZ,
+			const unsigned int faceta, const float nX, const float nY,
+			const float nZ);
+
+	/**
+	 * Escrever os fragmentos cobertos de um grupo de pixels consecutivos.
+	 * @param y linha do grupo.
+	 * @param x primeira coluna do grupo.
+	 * @param mascara pixels cobertos, com o bit k correspondendo à coluna x + k.
+	 * @param z profundidade na primeira coluna.
+	 * @param incrementoZ variação da profundidade por coluna.
+	 * @param faceta identificador da faceta dos fragmentos.
+	 * @param nX componente x da normal.
+	 * @param nY componente y da normal.
+	 * @param nZ componente z da normal.
+	 */
+	void escreverMascara(const int y, const int x, const unsigned int mascara,
+			const double z, const double incrementoZ,
+			const unsigned int faceta, const float nX, const float nY,
+			const float nZ);
+
+	/**
+	 * Verificar se algum fragmento foi escrito no pixel.
+	 * @param x coordenada x do pixel.
+	 * @param y coordenada y do pixel.
+	 * @return true caso o pixel esteja coberto.
+	 */
+	bool coberto(const unsigned int x, const unsigned int y) const;
+
+	/**
+	 * Obter a profundidade de um pixel.
+	 * @param x coordenada x do pixel.
+	 * @param y coordenada y do pixel.
+	 * @return profundidade armazenada.
+	 */
+	float getProfundidade(const unsigned int x, const unsigned int y) const;
+
+	/**
+	 * Obter a faceta visível em um pixel.
+	 * @param x coordenada x do pixel.
+	 * @param y coordenada y do pixel.
+	 * @return identificador da faceta, ou NENHUMA_FACETA.
+	 */
+	unsigned int getFaceta(const unsigned int x, const unsigned int y) const;
+
+	/**
+	 * Obter a normal de um pixel.
+	 * @param x coordenada x do pixel.
+	 * @param y coordenada y do pixel.
+	 * @param nX componente x da normal.
+	 * @param nY componente y da normal.
+	 * @param nZ componente z da normal.
+	 */
+	void getNormal(const unsigned int x, const unsigned int y, float* nX,
+			float* nY, float* nZ) const;
+
+	/**
+	 * Recalcular as profundidades mínima e máxima dos blocos que tocam uma
+	 * região, após a escrita de fragmentos nela.
+	 * @param area região alterada.
+	 */
+	void atualizarHierarquia(const QRect& area);
+
+	/**
+	 * Obter um limite inferior para a profundidade dos pixels de uma região,
+	 * segundo a hierarquia (atualizada por atualizarHierarquia).
+	 * @param area região consultada.
+	 * @return menor profundidade dos blocos que tocam a região.
+	 */
+	float getProfundidadeMinima(const QRect& area) const;
+
+	/**
+	 * Obter um limite superior para a profundidade dos pixels de uma região,
+	 * segundo a hierarquia (atualizada por atualizarHierarquia). Geometria
+	 * mais distante que esse limite está oculta em toda a região.
+	 * @param area região consultada.
+	 * @return maior profundidade dos blocos que tocam a região.
+	 */
+	float getProfundidadeMaxima(const QRect& area) const;
+
+	/**
+	 * Obter o número de fragmentos submetidos ao teste de profundidade desde
+	 * a última limpeza.
+	 * @return número de fragmentos testados.
+	 */
+	unsigned long getNumFragmentosTestados() const;
+
+	/**
+	 * Obter o número de fragmentos aprovados no teste de profundidade (e
+	 * escritos) desde a última limpeza.
+	 * @return número de fragmentos escritos.
+	 */
+	unsigned long getNumFragmentosEscritos() const;
+
+	/**
+	 * Obter o plano de profundidade.
+	 * @return ponteiro para o início do plano.
+	 */
+	float* getPlanoProfundidade();
+
+	/**
+	 * Obter o plano de facetas.
+	 * @return ponteiro para o início do plano.
+	 */
+	unsigned int* getPlanoFacetas();
+
+	/**
+	 * Obter os planos de normais compactadas.
+	 * @param nX plano da componente x.
+	 * @param nY plano da componente y.
+	 * @param nZ plano da componente z.
+	 */
+	void getPlanosNormais(signed char** nX, signed char** nY,
+			signed char** nZ);
+
+	/**
+	 * Verificar se o plano de normais foi alocado.
+	 * @return true caso o buffer armazene normais.
+	 */
+	bool temNormais() const;
+
+	/**
+	 * Obter a largura.
+	 * @return largura do buffer em pixels.
+	 */
+	unsigned int getLargura() const;
+
+	/**
+	 * Obter a altura.
+	 * @return altura do buffer em pixels.
+	 */
+	unsigned int getAltura() const;
+
+private:
+	/**
+	 * Compactar uma componente de normal em [-1, 1] para 8 bits.
+	 * @param n componente da normal.
+	 * @return componente compactada.
+	 */
+	static signed char compactarNormal(const float n);
+
+	/**
+	 * Contabilizar um teste de profundidade no bloco de um pixel.
+	 * @param x coordenada x do pixel.
+	 * @param y coordenada y do pixel.
+	 * @param testados número de fragmentos testados.
+	 * @param escritos número de fragmentos escritos.
+	 */
+	void contarFragmentos(const int x, const int y, const unsigned int testados,
+			const unsigned int escritos);
+
+	unsigned int largura;
+	unsigned int altura;
+	unsigned int blocosX;
+	unsigned int blocosY;
+	float* profundidade;
+	float* profundidadeMinimaBlocos;
+	float* profundidadeMaximaBlocos;
+	unsigned int* fragmentosTestadosBlocos;
+	unsigned int* fragmentosEscritosBlocos;
+	unsigned int* facetas;
+	signed char* normalX;
+	signed char* normalY;
+	signed char* normalZ;
+
+};
+
+#endif /* FRAMEBUFFER_H_ */
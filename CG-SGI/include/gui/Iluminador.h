@@ -6,6 +6,10 @@
 #include "gui/Pixel.h"
 #include "geometria/Ponto.h"
 
+/**
+ * Modelo de iluminação de Phong (componentes ambiente, difusa e especular)
+ * com uma fonte de luz pontual branca.
+ */
 class Iluminador {
 
 public:
@@ -24,23 +28,50 @@ public:
 	/**
 	 * Calcula a cor de cada pixel da viewport
 	 */
-	Pixel iluminarPixel(Pixel p);
+	Pixel iluminarPixel(Pixel p) const;
 
-private:
 	/**
-	 * Calcula a componente difusa da luz do pixel.
+	 * Calcular a cor iluminada de um ponto da superfície.
+	 * Não altera o iluminador, podendo ser chamado por várias threads.
+	 * @param x coordenada x do pixel.
+	 * @param y coordenada y do pixel.
+	 * @param z profundidade do pixel.
+	 * @param cor cor do material.
+	 * @param nX componente x da normal unitária.
+	 * @param nY componente y da normal unitária.
+	 * @param nZ componente z da normal unitária.
+	 * @return cor iluminada.
 	 */
-	QColor calcularComponenteDifusa(Pixel p);
+	QRgb iluminar(const unsigned int x, const unsigned int y,
+			const double z, const QRgb cor, const double nX, const double nY,
+			const double nZ) const;
 
 	/**
-	 * Calcula a componente especular da luz do pixel.
+	 * Iluminar uma sequência de pixels consecutivos de uma linha, a partir de
+	 * planos separados de profundidade, normal compactada e cor do material.
+	 * Calculado em precisão simples, com SSE2 ou AVX2 conforme
+	 * KernelsFragmentos::getConjuntoInstrucoes(); as versões vetoriais
+	 * produzem o mesmo resultado da escalar.
+	 * @param x coluna do primeiro pixel.
+	 * @param y linha dos pixels.
+	 * @param n número de pixels.
+	 * @param profundidade profundidade de cada pixel.
+	 * @param normalX componente x da normal de cada pixel, em [-127, 127].
+	 * @param normalY componente y da normal de cada pixel, em [-127, 127].
+	 * @param normalZ componente z da normal de cada pixel, em [-127, 127].
+	 * @param albedos cor do material de cada pixel.
+	 * @param destino cor iluminada de cada pixel.
 	 */
-	QColor calcularComponenteEspecular(Pixel p);
+	void iluminarSequencia(const unsigned int x, const unsigned int y,
+			const int n, const float* const profundidade,
+			const signed char* const normalX, const signed char* const normalY,
+			const signed char* const normalZ, const QRgb* const albedos,
+			QRgb* const destino) const;
 
-	/**
-	 * Calcula a componente ambiente da luz do pixel.
-	 */
-	QColor calcularComponenteAmbiente(Pixel p);
+private:
+	const double K_DIFUSA = 0.9;
+	const double K_ESPECULAR = 0.5;
+	const double K_AMBIENTE = 0.4;
 
 	unsigned int tamX;
 	unsigned int tamY;
@@ -0,0 +1,90 @@
+#ifndef KERNELSFRAGMENTOS_H_
+#define KERNELSFRAGMENTOS_H_
+
+/**
+ * Laços internos da rasterização sobre grupos de até LARGURA_GRUPO pixels
+ * consecutivos de uma linha: avaliação das funções de aresta e teste de
+ * profundidade com máscara.
+ *
+ * Há implementações escalar, SSE2 e AVX2, escolhidas em tempo de execução
+ * conforme o processador. Todas produzem resultados idênticos bit a bit: a
+ * profundidade do k-ésimo pixel é sempre z + (float) (indice + k) * dz em
+ * precisão simples, sem operações fundidas.
+ */
+class KernelsFragmentos {
+
+public:
+	/**
+	 * Conjunto de instruções utilizado pelos kernels.
+	 */
+	enum ConjuntoInstrucoes {
+		ESCALAR, SSE2, AVX2
+	};
+
+	/**
+	 * Número máximo de pixels processados por chamada.
+	 */
+	static const int LARGURA_GRUPO = 8;
+
+	/**
+	 * Detectar o conjunto de instruções mais amplo suportado pelo processador.
+	 * @return conjunto de instruções suportado.
+	 */
+	static ConjuntoInstrucoes detectarSuporte();
+
+	/**
+	 * Obter o conjunto de instruções em uso.
+	 * @return conjunto de instruções.
+	 */
+	static ConjuntoInstrucoes getConjuntoInstrucoes();
+
+	/**
+	 * Definir o conjunto de instruções em uso, limitado ao suportado pelo
+	 * processador.
+	 * @param conjunto conjunto de instruções desejado.
+	 */
+	static void setConjuntoInstrucoes(const ConjuntoInstrucoes conjunto);
+
+	/**
+	 * Calcular a cobertura de um grupo de pixels por um triângulo.
+	 * O chamador garante que w[i] + k * passoX[i] não transborda 32 bits.
+	 * @param w valor das três funções de aresta no primeiro pixel.
+	 * @param passoX variação das funções de aresta por coluna.
+	 * @param n número de pixels do grupo (até LARGURA_GRUPO).
+	 * @return máscara com o bit k ligado se o pixel k estiver coberto.
+	 */
+	static unsigned int calcularCobertura(const int* const w,
+			const int* const passoX, const int n);
+
+	/**
+	 * Testar e escrever a profundidade, faceta e normal de um grupo de pixels.
+	 * @param profundidade plano de profundidade, a partir do primeiro pixel.
+	 * @param facetas plano de facetas, a partir do primeiro pixel.
+	 * @param normalX plano de normais x, a partir do primeiro pixel (ou 0).
+	 * @param normalY plano de normais y, a partir do primeiro pixel (ou 0).
+	 * @param normalZ plano de normais z, a partir do primeiro pixel (ou 0).
+	 * @param n número de pixels do grupo (até LARGURA_GRUPO).
+	 * @param mascara pixels cobertos do grupo.
+	 * @param z profundidade de referência.
+	 * @param dz variação da profundidade por coluna.
+	 * @param indice coluna do primeiro pixel em relação à referência.
+	 * @param faceta identificador da faceta dos fragmentos.
+	 * @param nX componente x compactada da normal.
+	 * @param nY componente y compactada da normal.
+	 * @param nZ componente z compactada da normal.
+	 * @return número de fragmentos escritos.
+	 */
+	static int escreverFragmentos(float* const profundidade,
+			unsigned int* const facetas,
+			signed char* const normalX, signed char* const normalY,
+			signed char* const normalZ, const int n, const unsigned int mascara,
+			const float z, const float dz, const int indice,
+			const unsigned int faceta, const signed char nX,
+			const signed char nY, const signed char nZ);
+
+private:
+	static ConjuntoInstrucoes conjunto;
+
+};
+
+#endif /* KERNELSFRAGMENTOS_H_ */
@@ -0,0 +1,447 @@
+#ifndef RENDERIZADOR_H_
+#define RENDERIZADOR_H_
+
+#include <QtCore/qlist.h>
+#include <QtCore/qrect.h>
+#include <QtCore/qvector.h>
+#include <QtGui/qimage.h>
+#include <vector>
+
+#include "gui/clipping/ClippingCohenSutherland.h"
+#include "gui/clipping/ClippingLiangBarsky.h"
+#include "gui/FrameBuffer.h"
+#include "gui/Iluminador.h"
+#include "gui/rasterizacao/RasterizadorScanline.h"
+#include "gui/rasterizacao/RasterizadorSemiPlano.h"
+#include "util/OrdenacaoRadix.h"
+#include "util/PoolThreads.h"
+
+/**
+ * Renderização da cena em uma imagem, sem dependência de widgets.
+ * Os objetos são recortados e triangulados (descartando as facetas voltadas
+ * para trás dos objetos 3D) e os triângulos são distribuídos entre tiles da
+ * tela (sort-middle). Cada tile é limpo e rasterizado por uma única thread do
+ * pool, que escreve somente na sua região do G-buffer (profundidade, faceta e
+ * normal), dispensando sincronização. Objetos e blocos de facetas são
+ * ordenados a cada quadro (por padrão de frente para trás) e, em cada tile,
+ * os mais distantes que a hierarquia de profundidade já rasterizada são
+ * descartados sem configurar seus triângulos. A iluminação é
+ * adiada para uma segunda passada, em faixas de linhas, que calcula a cor
+ * somente dos pixels cobertos a partir da tabela de materiais das facetas.
+ * As normais das facetas vêm prontas dos objetos; no sombreamento flat e no
+ * de Gouraud a iluminação é avaliada por faceta ou por vértice ao preparar os
+ * triângulos, e a segunda passada apenas copia ou interpola as cores.
+ * Retas, curvas (pela sua tesselação) e pontos não são triangulados: seus
+ * segmentos recortados são distribuídos entre os tiles como os triângulos e
+ * rasterizados como linhas depois deles, no mesmo G-buffer. Nos modos
+ * aramados os objetos 3D são desenhados pelas suas arestas únicas, sem
+ * recorte geométrico (a rasterização das linhas se limita à área de
+ * clipping); com a remoção de linhas ocultas, as facetas são rasterizadas
+ * somente no buffer de profundidade, que então oculta as arestas.
+ */
+class Renderizador {
+
+public:
+	/**
+	 * Lado dos tiles, em pixels.
+	 */
+	static const int TAMANHO_TILE = 32;
+
+	/**
+	 * Altura das faixas de linhas iluminadas por tarefa.
+	 */
+	static const int ALTURA_FAIXA = 16;
+
+	/**
+	 * Número de triângulos a partir do qual as facetas seguintes de um objeto
+	 * formam um novo bloco, testado isoladamente contra a hierarquia de
+	 * profundidade.
+	 */
+	static const int TRIANGULOS_BLOCO = 32;
+
+	/**
+	 * Modo de sombreamento.
+	 * FLAT: uma avaliação da iluminação por faceta.
+	 * GOURAUD: uma avaliação por vértice, com as cores interpoladas.
+	 * PHONG: uma avaliação por pixel.
+	 */
+	enum ModoSombreamento {
+		FLAT, GOURAUD, PHONG
+	};
+
+	/**
+	 * Ordem de rasterização dos objetos e dos blocos de facetas.
+	 * SUBMISSAO: ordem da lista de objetos e das facetas no arquivo.
+	 * FRENTE_PARA_TRAS: menor profundidade primeiro, para que o teste de
+	 * profundidade e a hierarquia Z rejeitem cedo o que está oculto.
+	 * TRAS_PARA_FRENTE: maior profundidade primeiro (ordem do pintor).
+	 */
+	enum ModoOrdenacao {
+		SUBMISSAO, FRENTE_PARA_TRAS, TRAS_PARA_FRENTE
+	};
+
+	/**
+	 * Preenchimento dos objetos 3D.
+	 * SOLIDO: facetas preenchidas e sombreadas.
+	 * ARAMADO: todas as arestas, sem teste contra as facetas.
+	 * LINHAS_OCULTAS: arestas com remoção das linhas ocultas pelas facetas.
+	 */
+	enum ModoPreenchimento {
+		SOLIDO, ARAMADO, LINHAS_OCULTAS
+	};
+
+	/**
+	 * Construtor.
+	 * @param largura largura da imagem renderizada.
+	 * @param altura altura da imagem renderizada.
+	 * @param margemClipping margem, em pixels, entre a borda da imagem e a
+	 * área de clipping.
+	 * @param numThreads número de threads de renderização (0 para utilizar
+	 * todos os núcleos).
+	 */
+	Renderizador(const unsigned int largura, const unsigned int altura,
+			const unsigned int margemClipping, const unsigned int numThreads = 0);
+
+	/**
+	 * Destrutor.
+	 */
+	virtual ~Renderizador();
+
+	/**
+	 * Renderizar os objetos.
+	 * @param objetos objetos normalizados a serem desenhados.
+	 * @param imagem imagem de destino, com as dimensões do renderizador.
+	 */
+	void renderizar(const QList<ObjetoGeometrico*>& objetos,
+			QImage* const imagem);
+
+	/**
+	 * Definir o algoritmo de clipping.
+	 * @param algoritmo algoritmo a ser utilizado no recorte de objetos.
+	 */
+	void setAlgoritmoClippingLinhas(Clipping::AlgoritmoClippingLinha algoritmo);
+
+	/**
+	 * Definir o algoritmo de rasterização.
+	 * @param algoritmo algoritmo a ser utilizado na conversão de triângulos em pixels.
+	 */
+	void setAlgoritmoRasterizacao(Rasterizador::AlgoritmoRasterizacao algoritmo);
+
+	/**
+	 * Definir o modo de sombreamento.
+	 * @param modo modo utilizado a partir do próximo quadro.
+	 */
+	void setModoSombreamento(const ModoSombreamento modo);
+
+	/**
+	 * Obter o modo de sombreamento.
+	 * @return modo de sombreamento.
+	 */
+	ModoSombreamento getModoSombreamento() const;
+
+	/**
+	 * Definir a ordem de rasterização.
+	 * @param modo modo utilizado a partir do próximo quadro.
+	 */
+	void setModoOrdenacao(const ModoOrdenacao modo);
+
+	/**
+	 * Obter a ordem de rasterização.
+	 * @return modo de ordenação.
+	 */
+	ModoOrdenacao getModoOrdenacao() const;
+
+	/**
+	 * Definir o preenchimento dos objetos 3D.
+	 * @param modo modo utilizado a partir do próximo quadro.
+	 */
+	void setModoPreenchimento(const ModoPreenchimento modo);
+
+	/**
+	 * Obter o preenchimento dos objetos 3D.
+	 * @return modo de preenchimento.
+	 */
+	ModoPreenchimento getModoPreenchimento() const;
+
+	/**
+	 * Definir se as facetas voltadas para trás são descartadas. O descarte
+	 * só é aplicado aos objetos 3D que também o habilitam.
+	 * @param descarte true para descartar as faces traseiras.
+	 */
+	void setDescarteFacesTraseiras(const bool descarte);
+
+	/**
+	 * Verificar se as facetas voltadas para trás são descartadas.
+	 * @return true caso as faces traseiras sejam descartadas.
+	 */
+	bool isDescarteFacesTraseiras() const;
+
+	/**
+	 * Obter o número de facetas de objetos 3D visíveis na window no último
+	 * quadro.
+	 * @return número de facetas.
+	 */
+	unsigned int getNumFacetas() const;
+
+	/**
+	 * Obter o número de facetas descartadas por estarem voltadas para trás no
+	 * último quadro.
+	 * @return número de facetas descartadas.
+	 */
+	unsigned int getNumFacetasDescartadas() const;
+
+	/**
+	 * Obter o número de triângulos descartados pela hierarquia de
+	 * profundidade no último quadro, contados uma vez por tile em que seriam
+	 * rasterizados.
+	 * @return número de triângulos ocultos.
+	 */
+	unsigned int getNumTriangulosOcultos() const;
+
+	/**
+	 * Obter o número de fragmentos submetidos ao teste de profundidade no
+	 * último quadro (os de grupos descartados pela hierarquia Z não chegam a
+	 * ser testados).
+	 * @return número de fragmentos testados.
+	 */
+	unsigned long getNumFragmentosTestados() const;
+
+	/**
+	 * Obter a fração dos fragmentos do último quadro rejeitados pelo teste
+	 * de profundidade.
+	 * @return taxa de rejeição, entre 0 e 1.
+	 */
+	double getTaxaRejeicaoProfundidade() const;
+
+	/**
+	 * Obter o número de threads de renderização.
+	 * @return número de threads.
+	 */
+	unsigned int getNumThreads() const;
+
+	/**
+	 * Obter o frame buffer do último quadro renderizado.
+	 * @return frame buffer.
+	 */
+	const FrameBuffer* getFrameBuffer() const;
+
+private:
+	/**
+	 * Sequência contígua de triângulos (um objeto ou um bloco de facetas),
+	 * com o retângulo envolvente em pixels e os limites de profundidade.
+	 * Os triângulos de um objeto marcado como somenteProfundidade não
+	 * aparecem na imagem, apenas ocultam o que está atrás deles.
+	 */
+	struct GrupoTriangulos {
+		unsigned int inicio;
+		unsigned int fim;
+		float profundidadeMinima;
+		float profundidadeMaxima;
+		QRect area;
+		bool somenteProfundidade;
+	};
+
+	/**
+	 * Segmento de reta recortado, em coordenadas normalizadas (pontos são
+	 * segmentos de extremos iguais, rasterizados como um único fragmento).
+	 * faceta: entrada da tabela de materiais do objeto.
+	 * linha: índice do objeto entre as linhas do quadro.
+	 * continuacao: true caso comece no extremo final do segmento anterior.
+	 */
+	struct Segmento {
+		Ponto inicio;
+		Ponto fim;
+		unsigned int faceta;
+		unsigned int linha;
+		bool continuacao;
+	};
+
+	/**
+	 * Recortar e triangular os objetos, preenchendo as listas de triângulos
+	 * e de segmentos.
+	 * @param objetos objetos normalizados.
+	 */
+	void prepararTriangulos(const QList<ObjetoGeometrico*>& objetos);
+
+	/**
+	 * Iniciar um novo bloco de triângulos antes das facetas seguintes, caso
+	 * um novo objeto comece ou o bloco atual esteja cheio.
+	 * @param novoObjeto true caso as facetas seguintes sejam de outro objeto.
+	 */
+	void iniciarBloco(const bool novoObjeto);
+
+	/**
+	 * Distribuir os triângulos entre os tiles que seus retângulos envolventes
+	 * tocam, na ordem dada por ordenarBlocos, e os segmentos de linhas entre
+	 * os tiles dos seus.
+	 */
+	void distribuirTriangulos();
+
+	/**
+	 * Ordenar os blocos de facetas conforme o modo de ordenação: os objetos
+	 * são ordenados pela sua chave de profundidade e, dentro de cada objeto,
+	 * os blocos pela deles, com ordenação radix.
+	 * @param ordem índices dos blocos na ordem de rasterização.
+	 */
+	void ordenarBlocos(std::vector<unsigned int>* ordem) const;
+
+	/**
+	 * Obter a chave de ordenação de um grupo de triângulos: a profundidade
+	 * mínima de frente para trás, ou a máxima invertida de trás para frente.
+	 * @param grupo objeto ou bloco de facetas.
+	 * @return chave crescente na ordem de rasterização.
+	 */
+	unsigned int getChaveProfundidade(const GrupoTriangulos& grupo) const;
+
+	/**
+	 * Verificar se um grupo de triângulos está oculto em um tile, isto é, se
+	 * é mais distante que tudo o que já foi rasterizado na sua região.
+	 * @param grupo objeto ou bloco de facetas.
+	 * @param area região do tile.
+	 * @return true caso o grupo possa ser descartado no tile.
+	 */
+	bool isOculto(const GrupoTriangulos& grupo, const QRect& area) const;
+
+	/**
+	 * Registrar os triângulos de um objeto recortado como uma nova faceta na
+	 * tabela de materiais.
+	 * @param pontos pontos do objeto recortado (polígono ou faceta).
+	 * @param indices triangulação dos pontos, três índices por triângulo.
+	 * @param corFaceta cor do objeto.
+	 * @param normal normal da faceta em coordenadas normalizadas.
+	 * @param normaisVertices normais dos pontos do objeto, na mesma ordem
+	 * (vazia para utilizar a normal da faceta em todos os vértices).
+	 */
+	void adicionarTriangulos(const QList<Ponto>& pontos,
+			const QVector<int>& indices, const QColor& corFaceta,
+			const Ponto& normal, const QList<Ponto>& normaisVertices);
+
+	/**
+	 * Registrar os segmentos recortados de uma reta, curva ou ponto como uma
+	 * nova faceta na tabela de materiais, voltada para o observador.
+	 * @param extremos extremos dos segmentos, dois por segmento.
+	 * @param corLinha cor do objeto.
+	 */
+	void adicionarLinhas(const QList<Ponto>& extremos, const QColor& corLinha);
+
+	/**
+	 * Registrar a cor de um objeto desenhado por linhas como uma nova faceta
+	 * na tabela de materiais, voltada para o observador.
+	 * @param centro centro dos extremos dos segmentos do objeto.
+	 * @param corLinha cor do objeto.
+	 * @return índice da faceta.
+	 */
+	unsigned int adicionarCorLinha(const Ponto& centro, const QColor& corLinha);
+
+	/**
+	 * Registrar as arestas únicas de um objeto 3D como linhas, sem recorte.
+	 * Na remoção de linhas ocultas as arestas são aproximadas do observador
+	 * em uma fração da extensão em profundidade do objeto, para que não
+	 * disputem o teste de profundidade com as próprias facetas.
+	 * @param objeto objeto normalizado.
+	 */
+	void adicionarArestas(const Objeto3D* const objeto);
+
+	/**
+	 * Recortar cada segmento de uma polilinha pelo algoritmo de clipping de
+	 * linhas, sobre as coordenadas dos extremos, e registrar os visíveis
+	 * diretamente na lista de segmentos.
+	 * @param pontos pontos da polilinha.
+	 * @param corLinha cor do objeto.
+	 */
+	void recortarPolilinha(const QList<Ponto>& pontos, const QColor& corLinha);
+
+	/**
+	 * Converter uma normal de coordenadas normalizadas para as medidas da
+	 * viewport, onde é feita a iluminação.
+	 * @param normal normal em coordenadas normalizadas.
+	 * @param nX componente x da normal unitária.
+	 * @param nY componente y da normal unitária.
+	 * @param nZ componente z da normal unitária.
+	 */
+	void converterNormal(const Ponto& normal, double* nX, double* nY,
+			double* nZ) const;
+
+	/**
+	 * Iluminar um ponto em coordenadas normalizadas.
+	 * @param ponto ponto a ser iluminado.
+	 * @param cor cor do material.
+	 * @param nX componente x da normal.
+	 * @param nY componente y da normal.
+	 * @param nZ componente z da normal.
+	 * @return cor iluminada.
+	 */
+	QRgb iluminarPonto(const Ponto& ponto, const QRgb cor, const double nX,
+			const double nY, const double nZ) const;
+
+	/**
+	 * Registrar o gradiente de cores de um triângulo: para cada canal, os
+	 * coeficientes de c(x, y) = c0 + dx * x + dy * y nos pixels da imagem.
+	 * @param vertices vértices do triângulo em coordenadas normalizadas.
+	 * @param cores cores iluminadas dos vértices.
+	 */
+	void adicionarGradienteCores(const QList<Ponto>& vertices,
+			const QRgb cores[3]);
+
+	/**
+	 * Limpar e rasterizar um tile.
+	 * @param tile índice do tile.
+	 */
+	void rasterizarTile(const unsigned int tile);
+
+	/**
+	 * Iluminar os pixels cobertos de uma faixa de linhas e escrevê-la na
+	 * imagem. Cada sequência contígua de pixels cobertos de uma linha é
+	 * sombreada em lote conforme o modo de sombreamento; pixels não cobertos
+	 * recebem a cor de fundo.
+	 * @param faixa índice da faixa.
+	 * @param bits início dos pixels da imagem de destino.
+	 * @param bytesPorLinha bytes por linha da imagem de destino.
+	 */
+	void iluminarFaixa(const unsigned int faixa, uchar* const bits,
+			const int bytesPorLinha);
+
+	/**
+	 * Obter a região da imagem coberta por um tile.
+	 * @param tile índice do tile.
+	 * @return retângulo do tile, limitado à imagem.
+	 */
+	QRect getAreaTile(const unsigned int tile) const;
+
+	unsigned int largura;
+	unsigned int altura;
+	unsigned int margemClipping;
+	QRect areaClipping;
+	unsigned int tilesX;
+	unsigned int tilesY;
+	Clipping* clipping;
+	Rasterizador* rasterizador;
+	Iluminador* iluminador;
+	FrameBuffer* frameBuffer;
+	PoolThreads* pool;
+	QRgb corFundo;
+	ModoSombreamento modoSombreamento;
+	ModoOrdenacao modoOrdenacao;
+	ModoPreenchimento modoPreenchimento;
+	bool descarteFacesTraseiras;
+	unsigned int numFacetas;
+	unsigned int numFacetasDescartadas;
+	QVector<Poligono> triangulos;
+	QVector<unsigned int> facetasTriangulos;
+	QVector<QRgb> coresFacetas;
+	QVector<float> normaisFacetas;
+	QVector<QRgb> coresIluminadas;
+	QVector<float> gradientesCores;
+	QVector<GrupoTriangulos> objetosRenderizados;
+	QVector<GrupoTriangulos> blocosFacetas;
+	QVector<unsigned int> objetosBlocos;
+	QVector<unsigned int> blocosTriangulos;
+	QVector<Segmento> segmentos;
+	QVector<QRgb> coresLinhas;
+	std::vector<std::vector<unsigned int> > triangulosPorTile;
+	std::vector<std::vector<unsigned int> > segmentosPorTile;
+	std::vector<unsigned int> triangulosOcultosPorTile;
+
+};
+
+#endif /* RENDERIZADOR_H_ */
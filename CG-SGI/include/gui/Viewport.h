@@ -3,14 +3,15 @@
 
 #include <QtCore/qlist.h>
 #include <QtCore/qvector.h>
+#include <QtGui/qfont.h>
+#include <QtGui/qimage.h>
+#include <QtGui/qpixmap.h>
+#include <QtWidgets/qgraphicsitem.h>
 #include <QtWidgets/qgraphicsview.h>
 
 #include "geometria/Ponto.h"
 #include "geometria/Superficie.h"
-#include "gui/clipping/ClippingCohenSutherland.h"
-#include "gui/clipping/ClippingLiangBarsky.h"
-#include "gui/Rasterizador.h"
-#include "gui/Iluminador.h"
+#include "gui/Renderizador.h"
 
 /**
  * Janela de visualização da interface gráfica.
@@ -43,15 +44,81 @@ public:
 	 */
 	void setAlgoritmoClippingLinhas(Clipping::AlgoritmoClippingLinha algoritmo);
 
+	/**
+	 * Definir o algoritmo de rasterização.
+	 * @param algoritmo algoritmo a ser utilizado na conversão de triângulos em pixels.
+	 */
+	void setAlgoritmoRasterizacao(Rasterizador::AlgoritmoRasterizacao algoritmo);
+
+	/**
+	 * Definir o modo de sombreamento.
+	 * @param modo modo de sombreamento (flat, Gouraud ou Phong).
+	 */
+	void setModoSombreamento(Renderizador::ModoSombreamento modo);
+
+	/**
+	 * Definir se as facetas voltadas para trás são descartadas.
+	 * @param descarte true para descartar as faces traseiras.
+	 */
+	void setDescarteFacesTraseiras(bool descarte);
+
+	/**
+	 * Definir a ordem de rasterização.
+	 * @param modo ordem de submissão, de frente para trás ou de trás para
+	 * frente.
+	 */
+	void setModoOrdenacao(Renderizador::ModoOrdenacao modo);
+
+	/**
+	 * Definir o preenchimento dos objetos 3D.
+	 * @param modo sólido, aramado ou aramado com remoção de linhas ocultas.
+	 */
+	void setModoPreenchimento(Renderizador::ModoPreenchimento modo);
+
+	/**
+	 * Obter o número de facetas de objetos 3D no último quadro.
+	 * @return número de facetas.
+	 */
+	unsigned int getNumFacetas() const;
+
+	/**
+	 * Obter o número de facetas descartadas no último quadro.
+	 * @return número de facetas descartadas.
+	 */
+	unsigned int getNumFacetasDescartadas() const;
+
+	/**
+	 * Obter o número de triângulos descartados pela hierarquia de
+	 * profundidade no último quadro.
+	 * @return número de triângulos ocultos.
+	 */
+	unsigned int getNumTriangulosOcultos() const;
+
+	/**
+	 * Obter a fração dos fragmentos do último quadro rejeitados pelo teste
+	 * de profundidade.
+	 * @return taxa de rejeição, entre 0 e 1.
+	 */
+	double getTaxaRejeicaoProfundidade() const;
+
+	/**
+	 * Definir o texto do painel de desempenho, desenhado sobre a imagem.
+	 * @param texto texto do painel, com uma linha por medida.
+	 */
+	void setTextoDesempenho(const QString& texto);
+
+	/**
+	 * Exibir ou ocultar o painel de desempenho.
+	 * @param visivel true para exibir o painel.
+	 */
+	void setPainelDesempenhoVisivel(bool visivel);
+
 	/**
 	 * Obter os pontos da viewport.
 	 * @return lista com os pontos.
 	 */
 	QList<Ponto> getPontos() const;
 
-	void reiniciarMatrizPixels();
-	void desenharCena(QGraphicsScene* const scene);
-
 private:
 
 	/**
@@ -62,12 +129,14 @@ private:
 
 	const unsigned int MARGEM_CLIPPING = 20;
 	QGraphicsView* janelaGrafica;
-	Clipping* clipping;
-	Rasterizador* rasterizador;
+	QGraphicsScene* scene;
+	QGraphicsPixmapItem* itemImagem;
+	QGraphicsRectItem* fundoDesempenho;
+	QGraphicsSimpleTextItem* itemDesempenho;
+	QImage imagem;
+	Renderizador* renderizador;
 	unsigned int largura;
 	unsigned int altura;
-	Iluminador* iluminador;
-	Pixel **matrizPixels;
 
 };
 
@@ -57,6 +57,16 @@ public:
 	 */
 	ObjetoGeometrico* clipObjeto3D(Objeto3D* const objeto) const;
 
+	/**
+	 * Recortar um segmento de reta diretamente sobre as coordenadas dos
+	 * extremos, sem criar objetos. Os extremos recortados recebem a
+	 * profundidade interpolada no segmento.
+	 * @param p1 extremo inicial (x, y e z), substituído pelo recortado.
+	 * @param p2 extremo final (x, y e z), substituído pelo recortado.
+	 * @return false caso o segmento esteja fora da viewport.
+	 */
+	virtual bool clipSegmento(double* const p1, double* const p2) const = 0;
+
 protected:
 	/**
 	 * Recortar uma curva.
@@ -84,7 +94,17 @@ protected:
 	 * @param reta reta a ser recortada.
 	 * @return lista de pontos recortados.
 	 */
-	virtual ObjetoGeometrico* clipReta(const Reta* const reta) const = 0;
+	virtual ObjetoGeometrico* clipReta(const Reta* const reta) const;
+
+	/**
+	 * Atribuir a um ponto recortado sobre uma reta a profundidade
+	 * interpolada entre os extremos originais.
+	 * @param inicio extremo inicial da reta original (x, y e z).
+	 * @param fim extremo final da reta original (x, y e z).
+	 * @param p ponto da reta, com x e y já recortados.
+	 */
+	void interpolarProfundidade(const double inicio[3], const double fim[3],
+			double* const p) const;
 
 	double xvMin;
 	double xvMax;
@@ -23,71 +23,71 @@ public:
 	 */
 	virtual ~ClippingCohenSutherland();
 
-protected:
 	/**
-	 * Recortar uma reta.
-	 * @param reta reta a ser recortada.
-	 * @return lista de pontos recortados.
+	 * Recortar um segmento de reta sobre as coordenadas dos extremos.
+	 * @param p1 extremo inicial (x, y e z), substituído pelo recortado.
+	 * @param p2 extremo final (x, y e z), substituído pelo recortado.
+	 * @return false caso o segmento esteja fora da viewport.
 	 */
-	virtual ObjetoGeometrico* clipReta(const Reta* const reta) const;
+	virtual bool clipSegmento(double* const p1, double* const p2) const;
 
 private:
 	/**
 	 * Carregar o region code do ponto.
-	 * @param p ponto a ser verificado.
+	 * @param p coordenadas do ponto a ser verificado.
 	 * @param rc vetor no qual o region code será carregado.
 	 */
-	void carregarRcPonto(const Ponto* const p, short rc[4]) const;
+	void carregarRcPonto(const double* const p, short rc[4]) const;
 
 	/**
 	 * Recortar ponto quando ele está em um dos quadrantes paralelos à viewport.
 	 * @param rc region code do ponto.
-	 * @param p ponto a ser recortado.
+	 * @param p coordenadas do ponto a ser recortado.
 	 * @param coefAngular coeficiente angular da reta à qual o ponto pertence.
 	 * @return true se o ponto foi recortado.
 	 */
-	bool clippingBasico(short *rc, Ponto* const p, const double coefAngular) const;
+	bool clippingBasico(short *rc, double* const p, const double coefAngular) const;
 
 	/**
 	 * Recortar ponto quando ele está em um dos quadrantes diagonais.
 	 * @param rc region code do ponto.
-	 * @param p ponto a ser recortado.
+	 * @param p coordenadas do ponto a ser recortado.
 	 * @param coefAngular coeficiente angular da reta à qual o ponto pertence.
 	 * @return true se o ponto foi recortado.
 	 */
-	bool clippingComposto(short *rc, Ponto* const p, const double coefAngular) const;
+	bool clippingComposto(short *rc, double* const p, const double coefAngular) const;
 
 	/**
 	 * Recortar o ponto na borda direita.
-	 * @param p ponto a ser recortado.
+	 * @param p coordenadas do ponto a ser recortado.
 	 * @param coefAngular coeficiente angular da reta à qual o ponto pertence.
 	 * @return true se o ponto foi recortado.
 	 */
-	bool clippingDireita(Ponto* const p, const double coefAngular) const;
+	bool clippingDireita(double* const p, const double coefAngular) const;
 
 	/**
 	 * Recortar o ponto na borda esquerda.
-	 * @param p ponto a ser recortado.
+	 * @param p coordenadas do ponto a ser recortado.
 	 * @param coefAngular coeficiente angular da reta à qual o ponto pertence.
 	 * @return true se o ponto foi recortado.
 	 */
-	bool clippingEsquerda(Ponto* const p, const double coefAngular) const;
+	bool clippingEsquerda(double* const p, const double coefAngular) const;
 
 	/**
 	 * Recortar o ponto na borda do fundo.
-	 * @param p ponto a ser recortado.
+	 * @param p coordenadas do ponto a ser recortado.
 	 * @param coefAngular coeficiente angular da reta à qual o ponto pertence.
 	 * @return true se o ponto foi recortado.
 	 */
-	bool clippingFundo(Ponto* const p, const double coefAngular) const;
+	bool clippingFundo(double* const p, const double coefAngular) const;
 
 	/**
 	 * Recortar o ponto na borda do topo.
-	 * @param p ponto a ser recortado.
+	 * @param p coordenadas do ponto a ser recortado.
 	 * @param coefAngular coeficiente angular da reta à qual o ponto pertence.
 	 * @return true se o ponto foi recortado.
 	 */
-	bool clippingTopo(Ponto* const p, const double coefAngular) const;
+	bool clippingTopo(double* const p, const double coefAngular) const;
 
 };
 
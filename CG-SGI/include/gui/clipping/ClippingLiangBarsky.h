@@ -24,13 +24,13 @@ public:
 	 */
 	virtual ~ClippingLiangBarsky();
 
-protected:
 	/**
-	 * Recortar uma reta.
-	 * @param reta reta a ser recortada.
-	 * @return lista de pontos recortados.
+	 * Recortar um segmento de reta sobre as coordenadas dos extremos.
+	 * @param p1 extremo inicial (x, y e z), substituído pelo recortado.
+	 * @param p2 extremo final (x, y e z), substituído pelo recortado.
+	 * @return false caso o segmento esteja fora da viewport.
 	 */
-	virtual ObjetoGeometrico* clipReta(const Reta* const reta) const;
+	virtual bool clipSegmento(double* const p1, double* const p2) const;
 
 private:
 	/**
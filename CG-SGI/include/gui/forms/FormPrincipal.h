@@ -1,10 +1,12 @@
 #ifndef FORMPRINCIPAL_H_
 #define FORMPRINCIPAL_H_
 
+#include <QtWidgets/qaction.h>
 #include <QtWidgets/qdesktopwidget.h>
 #include <QtWidgets/qfiledialog.h>
 #include <QtWidgets/qmainwindow.h>
 #include <QtWidgets/qmenubar.h>
+#include <QtWidgets/qstatusbar.h>
 
 #include "controle/ControladorUI.h"
 #include "gui/forms/ui/ui_FormPrincipal.h"
@@ -172,13 +174,77 @@ private slots:
 	 */
 	void atualizarTipoProjecao(bool projecaoParalela);
 
+	/**
+	 * Atualizar algoritmo de rasterização.
+	 * @param acao item do menu selecionado.
+	 */
+	void atualizarAlgoritmoRasterizacao(QAction* acao);
+
+	/**
+	 * Atualizar modo de sombreamento.
+	 * @param acao item do menu selecionado.
+	 */
+	void atualizarModoSombreamento(QAction* acao);
+
+	/**
+	 * Atualizar a ordem de rasterização.
+	 * @param acao item do menu selecionado.
+	 */
+	void atualizarModoOrdenacao(QAction* acao);
+
+	/**
+	 * Atualizar o preenchimento dos objetos 3D.
+	 * @param acao item do menu selecionado.
+	 */
+	void atualizarModoPreenchimento(QAction* acao);
+
+	/**
+	 * Habilitar ou desabilitar o descarte de faces traseiras.
+	 * @param descarte true para descartar as faces traseiras.
+	 */
+	void atualizarDescarteFacesTraseiras(bool descarte);
+
+	/**
+	 * Exibir ou ocultar o painel de desempenho sobre a cena.
+	 * @param exibir true para exibir o painel.
+	 */
+	void exibirPainelDesempenho(bool exibir);
+
+	/**
+	 * Botão de exportar o histórico de desempenho pressionado.
+	 */
+	void exportarDesempenho();
+
+	/**
+	 * Habilitar ou desabilitar a gravação do rastreamento do pipeline.
+	 * @param gravar true para gravar os intervalos.
+	 */
+	void gravarRastreamento(bool gravar);
+
+	/**
+	 * Botão de exportar o rastreamento pressionado.
+	 */
+	void exportarRastreamento();
+
 private:
+	/**
+	 * Atualizar o painel de desempenho com o último quadro e as médias dos
+	 * quadros recentes.
+	 */
+	void atualizarPainelDesempenho();
+
+	/**
+	 * Número de quadros considerados nas médias do painel de desempenho.
+	 */
+	static const int QUADROS_MEDIA = 30;
+
 	ControladorUI* controladorUI;
 	Viewport* viewport;
 	int valorZoom;
 	int valorRotacaoX;
 	int valorRotacaoY;
 	int valorRotacaoZ;
+	bool painelDesempenho;
 
 };
 
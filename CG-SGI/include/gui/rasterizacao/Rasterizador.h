@@ -0,0 +1,128 @@
+#ifndef RASTERIZADOR_H_
+#define RASTERIZADOR_H_
+
+#include <QtCore/qrect.h>
+
+#include "geometria/Poligono.h"
+#include "geometria/Reta.h"
+#include "gui/DestinoFragmentos.h"
+
+/**
+ * Rasterização de objetos.
+ */
+class Rasterizador {
+
+public:
+	/**
+	 * Algoritmo de rasterização de triângulos.
+	 */
+	enum AlgoritmoRasterizacao {
+		SCANLINE, SEMI_PLANO
+	};
+
+	/**
+	 * Construtor.
+	 * @param algoritmo algoritmo implementado pelo rasterizador.
+	 * @param tamX largura da viewport.
+	 * @param tamY altura da viewport.
+	 */
+	Rasterizador(const AlgoritmoRasterizacao algoritmo, const unsigned int tamX,
+			const unsigned int tamY);
+
+	/**
+	 * Destrutor.
+	 */
+	virtual ~Rasterizador();
+
+	/**
+	 * Obter o algoritmo de rasterização.
+	 * @return algoritmo implementado pelo rasterizador.
+	 */
+	AlgoritmoRasterizacao getAlgoritmo() const;
+
+	/**
+	 * Rasterizar um ponto em coordenadas normalizadas como um único
+	 * fragmento, caso esteja na área.
+	 * @param ponto ponto a ser rasterizado.
+	 * @param faceta identificador gravado no fragmento.
+	 * @param nX componente x da normal gravada no fragmento.
+	 * @param nY componente y da normal gravada no fragmento.
+	 * @param nZ componente z da normal gravada no fragmento.
+	 * @param destino destino do fragmento.
+	 * @param area região da viewport (em pixels) a ser rasterizada.
+	 */
+	void rasterizarPonto(const Ponto& ponto, const unsigned int faceta,
+			const float nX, const float nY, const float nZ,
+			DestinoFragmentos* const destino, const QRect& area) const;
+
+	/**
+	 * Rasterizar um segmento de reta em coordenadas normalizadas pelo
+	 * algoritmo de Bresenham, com aritmética inteira e a profundidade
+	 * interpolada ao longo do eixo maior. Somente os passos dentro da área
+	 * são percorridos, e nenhuma memória é alocada.
+	 * @param p1 ponto inicial.
+	 * @param p2 ponto final.
+	 * @param faceta identificador gravado nos fragmentos.
+	 * @param nX componente x da normal gravada nos fragmentos.
+	 * @param nY componente y da normal gravada nos fragmentos.
+	 * @param nZ componente z da normal gravada nos fragmentos.
+	 * @param destino destino dos fragmentos gerados.
+	 * @param area região da viewport (em pixels) a ser rasterizada.
+	 * @param omitirInicio true para não gerar o pixel do ponto inicial, já
+	 * gerado pelo segmento anterior de uma polilinha.
+	 */
+	void rasterizarReta(const Ponto& p1, const Ponto& p2,
+			const unsigned int faceta, const float nX, const float nY,
+			const float nZ, DestinoFragmentos* const destino,
+			const QRect& area, const bool omitirInicio = false) const;
+
+	/**
+	 * Rasterizar um triângulo em coordenadas normalizadas, gerando somente
+	 * os fragmentos contidos na área. Não altera o rasterizador, podendo ser
+	 * chamado simultaneamente por várias threads em áreas disjuntas.
+	 * @param triangulo triângulo a ser rasterizado.
+	 * @param faceta identificador gravado nos fragmentos do triângulo.
+	 * @param nX componente x da normal gravada nos fragmentos.
+	 * @param nY componente y da normal gravada nos fragmentos.
+	 * @param nZ componente z da normal gravada nos fragmentos.
+	 * @param destino destino dos fragmentos gerados.
+	 * @param area região da viewport (em pixels) a ser rasterizada.
+	 */
+	virtual void rasterizarTriangulo(const Poligono& triangulo,
+			const unsigned int faceta, const float nX, const float nY,
+			const float nZ, DestinoFragmentos* const destino,
+			const QRect& area) const = 0;
+
+protected:
+
+	/**
+	 * Converter um ponto em coordenadas normalizadas para o pixel que o
+	 * contém (y para baixo).
+	 * @param ponto ponto convertido.
+	 * @param x coluna do pixel.
+	 * @param y linha do pixel.
+	 * @return false caso o ponto não tenha coordenadas finitas.
+	 */
+	bool converterPixel(const Ponto& ponto, int* x, int* y) const;
+
+	/**
+	 * Calcular a normal unitária de um triângulo nas medidas da viewport,
+	 * orientada para o observador (z negativo).
+	 * @param p1 primeiro vértice.
+	 * @param p2 segundo vértice.
+	 * @param p3 terceiro vértice.
+	 * @param nX componente x da normal.
+	 * @param nY componente y da normal.
+	 * @param nZ componente z da normal.
+	 */
+	void calcularNormal(const Ponto& p1, const Ponto& p2, const Ponto& p3,
+			float* nX, float* nY, float* nZ) const;
+
+	unsigned int tamX;
+	unsigned int tamY;
+
+private:
+	AlgoritmoRasterizacao algoritmo;
+};
+
+#endif /* RASTERIZADOR_H_ */
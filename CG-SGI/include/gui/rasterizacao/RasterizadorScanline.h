@@ -0,0 +1,70 @@
+#ifndef RASTERIZADORSCANLINE_H_
+#define RASTERIZADORSCANLINE_H_
+
+#include "gui/rasterizacao/Rasterizador.h"
+
+/**
+ * Rasterização por linhas de varredura sobre trapézios de bordas horizontais.
+ */
+class RasterizadorScanline : public Rasterizador {
+
+public:
+	/**
+	 * Construtor.
+	 * @param tamX largura da viewport.
+	 * @param tamY altura da viewport.
+	 */
+	RasterizadorScanline(const unsigned int tamX, const unsigned int tamY);
+
+	/**
+	 * Destrutor.
+	 */
+	virtual ~RasterizadorScanline();
+
+	/**
+	 * Rasterizar um triângulo em coordenadas normalizadas.
+	 * @param triangulo triângulo a ser rasterizado.
+	 * @param faceta identificador gravado nos fragmentos do triângulo.
+	 * @param nX componente x da normal gravada nos fragmentos.
+	 * @param nY componente y da normal gravada nos fragmentos.
+	 * @param nZ componente z da normal gravada nos fragmentos.
+	 * @param destino destino dos fragmentos gerados.
+	 * @param area região da viewport (em pixels) a ser rasterizada.
+	 */
+	void rasterizarTriangulo(const Poligono& triangulo,
+			const unsigned int faceta, const float nX, const float nY,
+			const float nZ, DestinoFragmentos* const destino,
+			const QRect& area) const;
+
+private:
+	/**
+	 * Divide o triângulo em trapézios que tenham bordas com y constante.
+	 * @param triangulo triângulo a ser transformado.
+	 */
+	QList<Poligono> paralelizarTriangulo(const Poligono& triangulo) const;
+
+	/*
+	 *Calcula a projeção de p em y na reta r
+	 *@param p ponto a ser projetado
+	 *@param r reta onde o ponto deve estar
+	 */
+	Ponto calcularInterseccao(Ponto p, Reta r) const;
+
+	/**
+	 * Converter um trapézio em spans horizontais.
+	 * @param trapezio trapézio com bordas de y constante.
+	 * @param faceta identificador gravado nos fragmentos do trapézio.
+	 * @param nX componente x da normal gravada nos fragmentos.
+	 * @param nY componente y da normal gravada nos fragmentos.
+	 * @param nZ componente z da normal gravada nos fragmentos.
+	 * @param destino destino dos fragmentos gerados.
+	 * @param area região da viewport (em pixels) a ser rasterizada.
+	 */
+	void rasterizarTrapezio(const Poligono& trapezio,
+			const unsigned int faceta, const float nX, const float nY,
+			const float nZ, DestinoFragmentos* const destino,
+			const QRect& area) const;
+
+};
+
+#endif /* RASTERIZADORSCANLINE_H_ */
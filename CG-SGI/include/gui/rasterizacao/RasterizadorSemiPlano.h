@@ -0,0 +1,55 @@
+#ifndef RASTERIZADORSEMIPLANO_H_
+#define RASTERIZADORSEMIPLANO_H_
+
+#include "gui/rasterizacao/Rasterizador.h"
+
+/**
+ * Rasterização por semi-planos (funções de aresta).
+ * Os vértices são fixados em uma grade de subpixels e as funções de aresta
+ * são avaliadas incrementalmente em inteiros, com a regra de preenchimento
+ * topo-esquerda. O retângulo envolvente é percorrido em blocos de 8x8 pixels,
+ * aceitos ou rejeitados por inteiro quando possível.
+ */
+class RasterizadorSemiPlano : public Rasterizador {
+
+public:
+	/**
+	 * Bits de precisão subpixel das coordenadas dos vértices.
+	 */
+	static const int BITS_SUBPIXEL = 4;
+
+	/**
+	 * Lado dos blocos percorridos, em pixels.
+	 */
+	static const int TAMANHO_BLOCO = 8;
+
+	/**
+	 * Construtor.
+	 * @param tamX largura da viewport.
+	 * @param tamY altura da viewport.
+	 */
+	RasterizadorSemiPlano(const unsigned int tamX, const unsigned int tamY);
+
+	/**
+	 * Destrutor.
+	 */
+	virtual ~RasterizadorSemiPlano();
+
+	/**
+	 * Rasterizar um triângulo em coordenadas normalizadas.
+	 * @param triangulo triângulo a ser rasterizado.
+	 * @param faceta identificador gravado nos fragmentos do triângulo.
+	 * @param nX componente x da normal gravada nos fragmentos.
+	 * @param nY componente y da normal gravada nos fragmentos.
+	 * @param nZ componente z da normal gravada nos fragmentos.
+	 * @param destino destino dos fragmentos gerados.
+	 * @param area região da viewport (em pixels) a ser rasterizada.
+	 */
+	void rasterizarTriangulo(const Poligono& triangulo,
+			const unsigned int faceta, const float nX, const float nY,
+			const float nZ, DestinoFragmentos* const destino,
+			const QRect& area) const;
+
+};
+
+#endif /* RASTERIZADORSEMIPLANO_H_ */
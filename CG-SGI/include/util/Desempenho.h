@@ -0,0 +1,191 @@
+#ifndef DESEMPENHO_H_
+#define DESEMPENHO_H_
+
+#include <string>
+
+/**
+ * Medição do tempo gasto em cada etapa do pipeline e dos contadores de
+ * trabalho de cada quadro.
+ * As etapas são medidas por cronômetros de escopo, que acumulam o tempo no
+ * quadro corrente; o quadro começa no primeiro cronômetro após o último
+ * fechamento e termina em finalizarQuadro, que o guarda em um histórico
+ * circular dos quadros mais recentes. Os acumuladores são atômicos, mas as
+ * etapas paralelas devem ser medidas pela thread que as submete, para que
+ * o tempo registrado seja o decorrido e não a soma das threads. Com o
+ * rastreamento habilitado, cada cronômetro também grava o seu intervalo.
+ */
+class Desempenho {
+
+public:
+	/**
+	 * Etapa do pipeline.
+	 * PROJECAO: projeção e normalização do display file pela window.
+	 * CLIPPING: cópia e recorte dos objetos.
+	 * TRIANGULACAO: triangulação das facetas e preparação dos triângulos.
+	 * DISTRIBUICAO: ordenação e distribuição dos triângulos entre os tiles.
+	 * RASTERIZACAO: conversão dos triângulos em fragmentos.
+	 * ILUMINACAO: sombreamento dos pixels cobertos.
+	 * APRESENTACAO: envio da imagem e da lista de objetos à interface.
+	 */
+	enum Etapa {
+		PROJECAO,
+		CLIPPING,
+		TRIANGULACAO,
+		DISTRIBUICAO,
+		RASTERIZACAO,
+		ILUMINACAO,
+		APRESENTACAO
+	};
+
+	/**
+	 * Contador de trabalho do quadro.
+	 * OBJETOS: objetos submetidos ao renderizador.
+	 * FACETAS: facetas de objetos 3D visíveis na window.
+	 * TRIANGULOS: triângulos gerados.
+	 * FRAGMENTOS: fragmentos submetidos ao teste de profundidade.
+	 * REJEICOES_PROFUNDIDADE: fragmentos rejeitados pelo teste.
+	 * ALOCACOES: alocações pelo operator new durante o quadro; contadas
+	 * somente quando compilado com CONTAR_ALOCACOES, e sem as alocações
+	 * internas dos contêineres do Qt, que usam malloc.
+	 */
+	enum Contador {
+		OBJETOS,
+		FACETAS,
+		TRIANGULOS,
+		FRAGMENTOS,
+		REJEICOES_PROFUNDIDADE,
+		ALOCACOES
+	};
+
+	/**
+	 * Número de etapas.
+	 */
+	static const int NUM_ETAPAS = 7;
+
+	/**
+	 * Número de contadores.
+	 */
+	static const int NUM_CONTADORES = 6;
+
+	/**
+	 * Número de quadros guardados no histórico.
+	 */
+	static const int CAPACIDADE_HISTORICO = 600;
+
+	/**
+	 * Medidas de um quadro. Os tempos estão em nanossegundos.
+	 */
+	struct Quadro {
+		unsigned long long numero;
+		long long inicio;
+		long long duracao;
+		long long etapas[NUM_ETAPAS];
+		unsigned long long contadores[NUM_CONTADORES];
+	};
+
+	/**
+	 * Cronômetro de escopo: acumula na etapa o tempo entre a sua construção
+	 * e a sua destruição.
+	 */
+	class Cronometro {
+
+	public:
+		/**
+		 * Construtor.
+		 * @param etapa etapa medida.
+		 */
+		Cronometro(const Etapa etapa);
+
+		/**
+		 * Destrutor.
+		 */
+		~Cronometro();
+
+	private:
+		Cronometro(const Cronometro&);
+		Cronometro& operator=(const Cronometro&);
+
+		Etapa etapa;
+		long long inicio;
+
+	};
+
+	/**
+	 * Acumular tempo em uma etapa do quadro corrente.
+	 * @param etapa etapa medida.
+	 * @param duracao tempo em nanossegundos.
+	 */
+	static void adicionarTempo(const Etapa etapa, const long long duracao);
+
+	/**
+	 * Somar a um contador do quadro corrente.
+	 * @param contador contador.
+	 * @param valor valor somado.
+	 */
+	static void contar(const Contador contador, const unsigned long long valor);
+
+	/**
+	 * Fechar o quadro corrente, guardando-o no histórico. Sem nenhuma etapa
+	 * medida desde o último fechamento, não faz nada.
+	 */
+	static void finalizarQuadro();
+
+	/**
+	 * Obter o número de quadros no histórico.
+	 * @return número de quadros, no máximo CAPACIDADE_HISTORICO.
+	 */
+	static int getNumQuadros();
+
+	/**
+	 * Obter um quadro do histórico.
+	 * @param indice 0 para o mais recente, 1 para o anterior e assim por
+	 * diante, até getNumQuadros() - 1.
+	 * @return medidas do quadro, ou um quadro zerado caso o índice esteja
+	 * fora do histórico.
+	 */
+	static Quadro getQuadro(const int indice);
+
+	/**
+	 * Obter a média dos quadros mais recentes.
+	 * @param numQuadros número de quadros considerados.
+	 * @return medidas médias (número e início do quadro mais recente).
+	 */
+	static Quadro getMedia(const int numQuadros);
+
+	/**
+	 * Limpar o histórico.
+	 */
+	static void limparHistorico();
+
+	/**
+	 * Gravar o histórico em CSV, um quadro por linha, do mais antigo ao mais
+	 * recente, com os tempos em milissegundos.
+	 * @param caminho caminho do arquivo.
+	 * @return false caso o arquivo não possa ser escrito.
+	 */
+	static bool exportarCSV(const std::string& caminho);
+
+	/**
+	 * Obter o número de alocações de memória desde o início do programa.
+	 * @return número de chamadas ao operator new; zero caso o programa não
+	 * tenha sido compilado com CONTAR_ALOCACOES.
+	 */
+	static unsigned long long getNumAlocacoes();
+
+	/**
+	 * Obter o nome de uma etapa.
+	 * @param etapa etapa.
+	 * @return nome em minúsculas.
+	 */
+	static const char* getNome(const Etapa etapa);
+
+	/**
+	 * Obter o nome de um contador.
+	 * @param contador contador.
+	 * @return nome em minúsculas.
+	 */
+	static const char* getNome(const Contador contador);
+
+};
+
+#endif /* DESEMPENHO_H_ */
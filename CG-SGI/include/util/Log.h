@@ -0,0 +1,181 @@
+#ifndef LOG_H_
+#define LOG_H_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * Nível mínimo compilado (0: depuração, 1: informação, 2: aviso, 3: erro,
+ * 4: nenhum). Chamadas de LOG abaixo dele são eliminadas pelo compilador,
+ * sem avaliar os argumentos.
+ */
+#ifndef NIVEL_LOG_COMPILADO
+#define NIVEL_LOG_COMPILADO 0
+#endif
+
+/**
+ * Registrar uma mensagem formatada (printf) de uma categoria e nível.
+ * Abaixo do nível compilado não gera código; acima dele, desabilitada em
+ * tempo de execução custa uma leitura atômica.
+ */
+#define LOG(categoria, nivel, ...) \
+	do { \
+		if ((nivel) >= NIVEL_LOG_COMPILADO \
+				&& Log::isHabilitado((categoria), (nivel))) \
+			Log::registrar((categoria), (nivel), __VA_ARGS__); \
+	} while (0)
+
+#define LOG_DEPURACAO(categoria, ...) LOG(categoria, Log::DEPURACAO, __VA_ARGS__)
+#define LOG_INFORMACAO(categoria, ...) LOG(categoria, Log::INFORMACAO, __VA_ARGS__)
+#define LOG_AVISO(categoria, ...) LOG(categoria, Log::AVISO, __VA_ARGS__)
+#define LOG_ERRO(categoria, ...) LOG(categoria, Log::ERRO, __VA_ARGS__)
+
+/**
+ * Registro de diagnósticos.
+ * As mensagens são gravadas em um buffer circular de tamanho fixo sem
+ * travas: cada escritora reserva uma posição com um incremento atômico e
+ * publica a entrada por um número de sequência, e as mais antigas são
+ * sobrescritas quando o buffer enche. A leitura (coletar, descarregar) é
+ * feita por uma única thread, fora dos laços críticos.
+ */
+class Log {
+
+public:
+	/**
+	 * Nível de severidade.
+	 */
+	enum Nivel {
+		DEPURACAO, INFORMACAO, AVISO, ERRO, NENHUM
+	};
+
+	/**
+	 * Subsistema de origem da mensagem.
+	 */
+	enum Categoria {
+		RENDERIZACAO, CLIPPING, PERSISTENCIA, MUNDO
+	};
+
+	/**
+	 * Número de categorias.
+	 */
+	static const int NUM_CATEGORIAS = 4;
+
+	/**
+	 * Número de entradas do buffer circular (potência de 2).
+	 */
+	static const unsigned int CAPACIDADE = 4096;
+
+	/**
+	 * Tamanho máximo de uma mensagem, incluindo o terminador.
+	 */
+	static const unsigned int TAMANHO_MENSAGEM = 112;
+
+	/**
+	 * Mensagem lida do buffer.
+	 */
+	struct Registro {
+		unsigned long long sequencia;
+		long long instante;
+		unsigned int thread;
+		Categoria categoria;
+		Nivel nivel;
+		std::string mensagem;
+	};
+
+	/**
+	 * Verificar se uma categoria registra mensagens de um nível.
+	 * @param categoria categoria da mensagem.
+	 * @param nivel nível da mensagem.
+	 * @return true caso o nível esteja habilitado para a categoria.
+	 */
+	static bool isHabilitado(const Categoria categoria, const Nivel nivel);
+
+	/**
+	 * Definir o nível mínimo registrado de uma categoria.
+	 * @param categoria categoria configurada.
+	 * @param nivel nível mínimo (NENHUM desabilita a categoria).
+	 */
+	static void setNivel(const Categoria categoria, const Nivel nivel);
+
+	/**
+	 * Definir o nível mínimo de todas as categorias.
+	 * @param nivel nível mínimo (NENHUM desabilita o log).
+	 */
+	static void setNivel(const Nivel nivel);
+
+	/**
+	 * Obter o nível mínimo registrado de uma categoria.
+	 * @param categoria categoria consultada.
+	 * @return nível mínimo.
+	 */
+	static Nivel getNivel(const Categoria categoria);
+
+	/**
+	 * Configurar os níveis a partir de um texto como
+	 * "aviso,renderizacao=depuracao": um nível sem categoria vale para todas.
+	 * @param especificacao lista de níveis separados por vírgula.
+	 * @return false caso algum item não seja reconhecido (os demais são
+	 * aplicados).
+	 */
+	static bool configurar(const std::string& especificacao);
+
+	/**
+	 * Gravar uma mensagem no buffer. Utilizar as macros LOG, que testam o
+	 * nível antes de formatar.
+	 * @param categoria categoria da mensagem.
+	 * @param nivel nível da mensagem.
+	 * @param formato formato da mensagem (printf), truncada em
+	 * TAMANHO_MENSAGEM.
+	 */
+	static void registrar(const Categoria categoria, const Nivel nivel,
+			const char* formato, ...)
+#ifdef __GNUC__
+			__attribute__((format(printf, 3, 4)))
+#endif
+			;
+
+	/**
+	 * Ler as mensagens gravadas desde a última leitura. Mensagens
+	 * sobrescritas antes de serem lidas são contadas como perdidas.
+	 * @param registros mensagens lidas, em ordem de gravação.
+	 * @return número de mensagens perdidas.
+	 */
+	static unsigned long long coletar(std::vector<Registro>* registros);
+
+	/**
+	 * Ler as mensagens pendentes e escrevê-las, uma por linha.
+	 * @param destino arquivo de saída.
+	 */
+	static void descarregar(FILE* const destino);
+
+	/**
+	 * Obter o nome de um nível.
+	 * @param nivel nível.
+	 * @return nome em minúsculas.
+	 */
+	static const char* getNome(const Nivel nivel);
+
+	/**
+	 * Obter o nome de uma categoria.
+	 * @param categoria categoria.
+	 * @return nome em minúsculas.
+	 */
+	static const char* getNome(const Categoria categoria);
+
+	/**
+	 * Obter o identificador sequencial da thread atual, atribuído no seu
+	 * primeiro registro (a primeira thread a registrar recebe 0).
+	 * @return identificador da thread.
+	 */
+	static unsigned int getThreadAtual();
+
+	/**
+	 * Obter o tempo decorrido desde o início do programa.
+	 * @return instante em nanossegundos.
+	 */
+	static long long getInstante();
+
+};
+
+#endif /* LOG_H_ */
@@ -0,0 +1,34 @@
+#ifndef ORDENACAORADIX_H_
+#define ORDENACAORADIX_H_
+
+#include <vector>
+
+/**
+ * Ordenação radix (LSD) de índices por chaves inteiras sem sinal.
+ * Estável e linear no número de chaves: os dígitos de 8 bits são
+ * distribuídos do menos para o mais significativo, pulando as passadas em
+ * que todas as chaves têm o mesmo dígito (comum nos bits altos).
+ */
+class OrdenacaoRadix {
+
+public:
+	/**
+	 * Ordenar índices em ordem crescente de chave.
+	 * @param chaves chave de cada elemento.
+	 * @param indices índices dos elementos (0 a n - 1) em ordem crescente de
+	 * chave; empates mantêm a ordem original.
+	 */
+	static void ordenar(const std::vector<unsigned long long>& chaves,
+			std::vector<unsigned int>* indices);
+
+	/**
+	 * Converter uma profundidade em chave de ordenação, preservando a ordem
+	 * (inclusive entre valores negativos).
+	 * @param z profundidade.
+	 * @return chave de 32 bits.
+	 */
+	static unsigned int converterProfundidade(const float z);
+
+};
+
+#endif /* ORDENACAORADIX_H_ */
@@ -0,0 +1,69 @@
+#ifndef POOLTHREADS_H_
+#define POOLTHREADS_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Conjunto fixo de threads trabalhadoras.
+ * As tarefas de um lote são identificadas por índices e distribuídas
+ * dinamicamente entre as trabalhadoras e a thread que submeteu o lote.
+ */
+class PoolThreads {
+
+public:
+	/**
+	 * Construtor.
+	 * @param numThreads número total de threads, incluindo a que submete os
+	 * lotes. Com 0, utiliza o número de núcleos da máquina.
+	 */
+	PoolThreads(const unsigned int numThreads = 0);
+
+	/**
+	 * Destrutor.
+	 */
+	virtual ~PoolThreads();
+
+	/**
+	 * Obter o número de threads que executam as tarefas.
+	 * @return número de threads, incluindo a que submete os lotes.
+	 */
+	unsigned int getNumThreads() const;
+
+	/**
+	 * Executar um lote de tarefas, retornando quando todas terminarem.
+	 * @param numTarefas número de tarefas do lote.
+	 * @param tarefa função chamada com o índice de cada tarefa.
+	 */
+	void executar(const unsigned int numTarefas,
+			const std::function<void(unsigned int)>& tarefa);
+
+private:
+	/**
+	 * Laço das threads trabalhadoras.
+	 */
+	void trabalhar();
+
+	/**
+	 * Consumir tarefas do lote atual até que se esgotem.
+	 */
+	void consumirTarefas();
+
+	std::vector<std::thread> trabalhadoras;
+	std::mutex mutex;
+	std::condition_variable condicaoLote;
+	std::condition_variable condicaoFim;
+	const std::function<void(unsigned int)>* tarefa;
+	unsigned int numTarefas;
+	std::atomic<unsigned int> proximaTarefa;
+	unsigned int trabalhadorasAtivas;
+	unsigned long lote;
+	bool encerrar;
+
+};
+
+#endif /* POOLTHREADS_H_ */
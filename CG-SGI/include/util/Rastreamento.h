@@ -0,0 +1,102 @@
+#ifndef RASTREAMENTO_H_
+#define RASTREAMENTO_H_
+
+#include <string>
+
+/**
+ * Registro da linha do tempo do pipeline para análise no chrome://tracing
+ * ou no Perfetto.
+ * Cada intervalo (importação, etapas do quadro, tiles, faixas, eventos da
+ * interface) é gravado com a thread e os instantes de início e fim em um
+ * buffer circular sem travas, como o do log: os mais antigos são
+ * sobrescritos quando o buffer enche. Desabilitado, um intervalo custa uma
+ * leitura atômica.
+ */
+class Rastreamento {
+
+public:
+	/**
+	 * Número de intervalos guardados (potência de 2).
+	 */
+	static const unsigned int CAPACIDADE = 1 << 18;
+
+	/**
+	 * Número máximo de threads nomeadas.
+	 */
+	static const unsigned int MAXIMO_THREADS = 256;
+
+	/**
+	 * Intervalo de escopo: registra o tempo entre a sua construção e a sua
+	 * destruição, caso o rastreamento esteja habilitado na construção.
+	 */
+	class Intervalo {
+
+	public:
+		/**
+		 * Construtor.
+		 * @param nome nome do intervalo (literal, não copiado).
+		 * @param categoria categoria do intervalo (literal, não copiado).
+		 * @param argumento índice associado ao intervalo (tile, faixa,
+		 * tipo de evento), ou -1 para nenhum.
+		 */
+		Intervalo(const char* nome, const char* categoria,
+				const int argumento = -1);
+
+		/**
+		 * Destrutor.
+		 */
+		~Intervalo();
+
+	private:
+		Intervalo(const Intervalo&);
+		Intervalo& operator=(const Intervalo&);
+
+		const char* nome;
+		const char* categoria;
+		int argumento;
+		long long inicio;
+
+	};
+
+	/**
+	 * Habilitar ou desabilitar o registro. O buffer é alocado na primeira
+	 * habilitação.
+	 * @param habilitar true para registrar os intervalos.
+	 */
+	static void setHabilitado(const bool habilitar);
+
+	/**
+	 * Verificar se os intervalos estão sendo registrados.
+	 * @return true caso o registro esteja habilitado.
+	 */
+	static bool isHabilitado();
+
+	/**
+	 * Registrar um intervalo já medido.
+	 * @param nome nome do intervalo (literal, não copiado).
+	 * @param categoria categoria do intervalo (literal, não copiado).
+	 * @param inicio instante inicial (Log::getInstante), em nanossegundos.
+	 * @param duracao duração em nanossegundos.
+	 * @param argumento índice associado, ou -1 para nenhum.
+	 */
+	static void registrar(const char* nome, const char* categoria,
+			const long long inicio, const long long duracao,
+			const int argumento = -1);
+
+	/**
+	 * Dar um nome à thread atual, exibido na linha do tempo.
+	 * @param nome nome da thread.
+	 */
+	static void nomearThread(const std::string& nome);
+
+	/**
+	 * Gravar os intervalos do buffer no formato de eventos de rastreamento
+	 * do Chrome (JSON), com os instantes em microssegundos.
+	 * @param caminho caminho do arquivo.
+	 * @return false caso o arquivo não possa ser escrito.
+	 */
+	static bool exportar(const std::string& caminho);
+
+};
+
+#endif /* RASTREAMENTO_H_ */
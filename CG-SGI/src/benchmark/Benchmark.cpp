@@ -0,0 +1,264 @@
+#include "benchmark/Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+static volatile double sumidouro = 0;
+
+// Definição da constante, que std::max recebe por referência
+const unsigned int Benchmark::MINIMO_REPETICOES;
+
+Benchmark::Benchmark(const unsigned int repeticoes, const double tempoMaximo,
+		const std::string& filtro) {
+	this->repeticoes = std::max(repeticoes, MINIMO_REPETICOES);
+	this->tempoMaximo = tempoMaximo;
+	this->filtro = filtro;
+	this->numFalhas = 0;
+}
+
+Benchmark::~Benchmark() {}
+
+bool Benchmark::isSelecionado(const std::string& nome) const {
+	return nome.compare(0, this->filtro.size(), this->filtro) == 0;
+}
+
+bool Benchmark::isGrupoSelecionado(const std::string& prefixo) const {
+	size_t n = std::min(prefixo.size(), this->filtro.size());
+
+	return prefixo.compare(0, n, this->filtro, 0, n) == 0;
+}
+
+void Benchmark::executar(const std::string& nome,
+		const unsigned long long operacoes, const std::function<void()>& caso,
+		const std::function<void()>& preparar) {
+	if (!this->isSelecionado(nome))
+		return;
+
+	// Aquecimento: caches, alocador e caminhos preguiçosos
+	if (preparar)
+		preparar();
+
+	caso();
+
+	std::vector<double> amostras;
+	double total = 0;
+
+	while (amostras.size() < this->repeticoes
+			&& (amostras.size() < MINIMO_REPETICOES
+					|| total < this->tempoMaximo * 1e9)) {
+		if (preparar)
+			preparar();
+
+		std::chrono::steady_clock::time_point inicio =
+				std::chrono::steady_clock::now();
+		caso();
+		double duracao = std::chrono::duration<double, std::nano>(
+				std::chrono::steady_clock::now() - inicio).count();
+
+		amostras.push_back(duracao);
+		total += duracao;
+	}
+
+	std::sort(amostras.begin(), amostras.end());
+
+	Resultado resultado;
+	resultado.nome = nome;
+	resultado.operacoes = operacoes;
+	resultado.repeticoes = amostras.size();
+	resultado.minimo = amostras.front();
+	resultado.mediana = Benchmark::getPercentil(amostras, 50);
+	resultado.media = total / amostras.size();
+	resultado.p90 = Benchmark::getPercentil(amostras, 90);
+	resultado.p99 = Benchmark::getPercentil(amostras, 99);
+	resultado.maximo = amostras.back();
+	this->resultados.push_back(resultado);
+
+	fprintf(stderr, "%-40s %12.3f ms (p90 %.3f ms, %u repetições)\n",
+			nome.c_str(), resultado.mediana / 1e6, resultado.p90 / 1e6,
+			resultado.repeticoes);
+}
+
+void Benchmark::registrarFalha(const std::string& nome,
+		const std::string& mensagem) {
+	fprintf(stderr, "FALHA %s: %s\n", nome.c_str(), mensagem.c_str());
+	this->numFalhas++;
+}
+
+unsigned int Benchmark::getNumFalhas() const {
+	return this->numFalhas;
+}
+
+const std::vector<Benchmark::Resultado>& Benchmark::getResultados() const {
+	return this->resultados;
+}
+
+bool Benchmark::gravar(const std::string& caminho) const {
+	FILE* arquivo = caminho == "-" ? stdout : fopen(caminho.c_str(), "w");
+
+	if (arquivo == 0)
+		return false;
+
+	fprintf(arquivo, "{\n\"unidade\": \"ns\",\n\"resultados\": [\n");
+
+	for (unsigned int i = 0; i < this->resultados.size(); i++) {
+		const Resultado& r = this->resultados[i];
+		fprintf(arquivo, "{\"nome\": \"%s\", \"operacoes\": %llu, "
+				"\"repeticoes\": %u, \"minimo\": %.0f, \"mediana\": %.0f, "
+				"\"media\": %.0f, \"p90\": %.0f, \"p99\": %.0f, "
+				"\"maximo\": %.0f}%s\n", r.nome.c_str(), r.operacoes,
+				r.repeticoes, r.minimo, r.mediana, r.media, r.p90, r.p99,
+				r.maximo, i + 1 < this->resultados.size() ? "," : "");
+	}
+
+	fprintf(arquivo, "]\n}\n");
+
+	if (arquivo == stdout)
+		return fflush(arquivo) == 0;
+
+	return fclose(arquivo) == 0;
+}
+
+/**
+ * Obter o valor de um campo de um objeto JSON plano.
+ * @return o texto do valor (sem aspas), ou vazio caso o campo não exista.
+ */
+static std::string lerCampo(const std::string& objeto,
+		const std::string& campo) {
+	size_t posicao = objeto.find("\"" + campo + "\"");
+
+	if (posicao == std::string::npos)
+		return "";
+
+	posicao = objeto.find(':', posicao);
+
+	if (posicao == std::string::npos)
+		return "";
+
+	posicao = objeto.find_first_not_of(" \t\r\n", posicao + 1);
+
+	if (posicao == std::string::npos)
+		return "";
+
+	if (objeto[posicao] == '"') {
+		size_t fim = objeto.find('"', posicao + 1);
+		return objeto.substr(posicao + 1, fim - posicao - 1);
+	}
+
+	size_t fim = objeto.find_first_of(",} \t\r\n", posicao);
+	return objeto.substr(posicao, fim - posicao);
+}
+
+bool Benchmark::ler(const std::string& caminho,
+		std::vector<Resultado>* resultados) {
+	std::ifstream arquivo(caminho.c_str());
+
+	if (!arquivo.is_open())
+		return false;
+
+	std::stringstream conteudo;
+	conteudo << arquivo.rdbuf();
+	std::string texto = conteudo.str();
+	size_t posicao = texto.find("\"resultados\"");
+
+	if (posicao == std::string::npos)
+		return false;
+
+	// Os resultados são objetos planos, sem chaves aninhadas
+	while ((posicao = texto.find('{', posicao)) != std::string::npos) {
+		size_t fim = texto.find('}', posicao);
+
+		if (fim == std::string::npos)
+			return false;
+
+		std::string objeto = texto.substr(posicao, fim - posicao + 1);
+		Resultado r;
+		r.nome = lerCampo(objeto, "nome");
+		r.operacoes = strtoull(lerCampo(objeto, "operacoes").c_str(), 0, 10);
+		r.repeticoes = atoi(lerCampo(objeto, "repeticoes").c_str());
+		r.minimo = atof(lerCampo(objeto, "minimo").c_str());
+		r.mediana = atof(lerCampo(objeto, "mediana").c_str());
+		r.media = atof(lerCampo(objeto, "media").c_str());
+		r.p90 = atof(lerCampo(objeto, "p90").c_str());
+		r.p99 = atof(lerCampo(objeto, "p99").c_str());
+		r.maximo = atof(lerCampo(objeto, "maximo").c_str());
+
+		if (!r.nome.empty())
+			resultados->push_back(r);
+
+		posicao = fim + 1;
+	}
+
+	return true;
+}
+
+unsigned int Benchmark::comparar(const std::vector<Resultado>& referencia,
+		const std::vector<Resultado>& atuais, const double limiar) {
+	unsigned int regressoes = 0;
+	unsigned int ausentes = 0;
+
+	printf("%-40s %12s %12s %8s\n", "caso", "referencia", "atual", "razao");
+
+	for (const Resultado& atual : atuais) {
+		std::vector<Resultado>::const_iterator base = std::find_if(
+				referencia.begin(), referencia.end(),
+				[&atual](const Resultado& r) {return r.nome == atual.nome;});
+
+		if (base == referencia.end()) {
+			printf("%-40s %12s %9.3f ms %8s  novo\n", atual.nome.c_str(), "-",
+					atual.mediana / 1e6, "-");
+			continue;
+		}
+
+		if (base->mediana <= 0)
+			continue;
+
+		double razao = atual.mediana / base->mediana;
+		const char* situacao = "";
+
+		if (razao > 1 + limiar && atual.minimo > base->mediana) {
+			situacao = "  REGRESSAO";
+			regressoes++;
+		} else if (razao < 1 / (1 + limiar) && atual.maximo < base->mediana) {
+			situacao = "  melhoria";
+		}
+
+		printf("%-40s %9.3f ms %9.3f ms %7.2fx%s\n", atual.nome.c_str(),
+				base->mediana / 1e6, atual.mediana / 1e6, razao, situacao);
+	}
+
+	// Remover ou renomear um caso lento não pode passar pela comparação
+	for (const Resultado& base : referencia) {
+		bool executado = std::find_if(atuais.begin(), atuais.end(),
+				[&base](const Resultado& r) {return r.nome == base.nome;})
+				!= atuais.end();
+
+		if (executado)
+			continue;
+
+		printf("%-40s %9.3f ms %12s %8s  AUSENTE\n", base.nome.c_str(),
+				base.mediana / 1e6, "-", "-");
+		ausentes++;
+	}
+
+	printf("%u regressões acima de %.0f%%, %u casos ausentes\n", regressoes,
+			limiar * 100, ausentes);
+
+	return regressoes + ausentes;
+}
+
+void Benchmark::consumir(const double valor) {
+	sumidouro = sumidouro + valor;
+}
+
+double Benchmark::getPercentil(const std::vector<double>& amostras,
+		const double percentil) {
+	size_t posto = (size_t) ceil(percentil / 100 * amostras.size());
+
+	return amostras[std::min(std::max(posto, (size_t) 1), amostras.size())
+			- 1];
+}
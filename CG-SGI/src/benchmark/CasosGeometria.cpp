@@ -0,0 +1,295 @@
+#include "benchmark/Casos.h"
+#include "geometria/KernelsVertices.h"
+#include "geometria/Triangulador.h"
+#include "persistencia/ArquivoOBJ.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+bool Casos::carregarCena(const String& arquivo, const double zoom,
+		Mundo* mundo) {
+	try {
+		ArquivoOBJ arquivoObj(arquivo);
+		arquivoObj.carregar();
+		Cena* cena = arquivoObj.getCena();
+
+		for (ObjetoGeometrico* objeto : cena->getObjetos())
+			mundo->inserirObjeto(*objeto);
+
+		delete cena;
+	} catch (Excecao& ex) {
+		fprintf(stderr, "%s\n", ex.getMensagem().c_str());
+		return false;
+	}
+
+	if (zoom != 0)
+		mundo->aplicarZoom(zoom);
+
+	return true;
+}
+
+void Casos::executarPersistencia(Benchmark* benchmark) {
+	const String cenas[2][2] = { { "obj/basicman", ArquivoOBJ::BASIC_MAN },
+			{ "obj/cristo", ArquivoOBJ::CRISTO_REDENTOR } };
+
+	for (const String* cena : cenas) {
+		String arquivo = cena[1];
+
+		benchmark->executar(cena[0], 1, [arquivo] {
+			ArquivoOBJ arquivoObj(arquivo);
+			arquivoObj.carregar();
+			delete arquivoObj.getCena();
+		});
+	}
+}
+
+void Casos::executarDisplayFile(Benchmark* benchmark) {
+	for (unsigned int n = 10; n <= 1000000; n *= 10) {
+		String tamanho = std::to_string(n);
+
+		if (!benchmark->isSelecionado("displayfile/insercao/" + tamanho)
+				&& !benchmark->isSelecionado("displayfile/busca_nome/" + tamanho)
+				&& !benchmark->isSelecionado(
+						"displayfile/busca_posicao/" + tamanho))
+			continue;
+
+		std::vector<Ponto> pontos;
+		pontos.reserve(n);
+
+		for (unsigned int i = 0; i < n; i++)
+			pontos.push_back(Ponto("p" + std::to_string(i), i % 1000,
+					i / 1000, 0));
+
+		DisplayFile* displayFile = new DisplayFile();
+
+		benchmark->executar("displayfile/insercao/" + tamanho, n,
+				[&pontos, displayFile] {
+					for (const Ponto& p : pontos)
+						displayFile->inserirObjeto(p);
+				}, [displayFile] {
+					displayFile->removerObjetos();
+				});
+
+		// Buscas em um display file completo, em ordem pseudoaleatória
+		if (displayFile->getTamanho() != n) {
+			displayFile->removerObjetos();
+
+			for (const Ponto& p : pontos)
+				displayFile->inserirObjeto(p);
+		}
+
+		unsigned int numBuscas = std::min(n, 10000u);
+		std::vector<String> nomes;
+		std::vector<unsigned int> posicoes;
+
+		for (unsigned int i = 0; i < numBuscas; i++) {
+			unsigned int k = (unsigned int) ((i * 2654435761ull) % n);
+			nomes.push_back(pontos[k].getNome());
+			posicoes.push_back(k);
+		}
+
+		benchmark->executar("displayfile/busca_nome/" + tamanho, numBuscas,
+				[&nomes, displayFile] {
+					double soma = 0;
+
+					for (const String& nome : nomes)
+						soma += displayFile->getObjeto(nome)->getCentroGeometrico().getX();
+
+					Benchmark::consumir(soma);
+				});
+
+		// A busca por posição percorre o mapa até o objeto: poucas buscas
+		unsigned int numPosicoes = std::min(n, 100u);
+
+		benchmark->executar("displayfile/busca_posicao/" + tamanho,
+				numPosicoes, [&posicoes, numPosicoes, displayFile] {
+					double soma = 0;
+
+					for (unsigned int i = 0; i < numPosicoes; i++)
+						soma += displayFile->getObjeto(posicoes[i])->getCentroGeometrico().getX();
+
+					Benchmark::consumir(soma);
+				});
+
+		displayFile->removerObjetos();
+		delete displayFile;
+	}
+}
+
+void Casos::executarTransformacao(Benchmark* benchmark) {
+	const String cenas[2][2] = { { "basicman", ArquivoOBJ::BASIC_MAN }, {
+			"cristo", ArquivoOBJ::CRISTO_REDENTOR } };
+	double angulo = M_PI / 180;
+	double matriz[4][4] = { { cos(angulo), 0, sin(angulo), 0 },
+			{ 0, 1, 0, 0 }, { -sin(angulo), 0, cos(angulo), 0 },
+			{ 0, 0, 0, 1 } };
+
+	for (const String* cena : cenas) {
+		if (!benchmark->isSelecionado("transformacao/" + cena[0])
+				&& !benchmark->isSelecionado("clonagem/" + cena[0])
+				&& !benchmark->isSelecionado("projecao/" + cena[0])
+				&& !benchmark->isSelecionado(
+						"projecao/incremental/" + cena[0]))
+			continue;
+
+		Mundo mundo;
+
+		if (!Casos::carregarCena(cena[1], 0, &mundo))
+			continue;
+
+		ObjetoGeometrico* objeto = mundo.getObjetosReais().first();
+		unsigned int numPontos = objeto->getPontos().size();
+
+		benchmark->executar("transformacao/" + cena[0], numPontos,
+				[objeto, &matriz] {
+					objeto->aplicarTransformacao(matriz);
+				});
+
+		// Cópia de todos os objetos, como a feita a cada quadro para o
+		// clipping
+		QList<ObjetoGeometrico*> objetos = mundo.getObjetosReais();
+
+		benchmark->executar("clonagem/" + cena[0], numPontos, [&objetos] {
+			for (ObjetoGeometrico* obj : objetos)
+				delete obj->clonar();
+		});
+
+		// Projeção e normalização de toda a cena pela window
+		benchmark->executar("projecao/" + cena[0], numPontos, [&mundo] {
+			mundo.setProjetorVisualizacao(Projetor::PERSPECTIVA);
+		});
+
+		// Transformação de um objeto pequeno: somente ele é reprojetado
+		mundo.inserirObjeto(Reta("reta", Ponto("", 0, 0, 0), Ponto("", 1, 1, 1)));
+		ObjetoGeometrico* reta = mundo.getObjeto("reta");
+
+		benchmark->executar("projecao/incremental/" + cena[0], 1,
+				[&mundo, reta] {
+					mundo.transladarObjeto(reta, 1, 0, 0);
+				});
+	}
+
+	QList<Ponto> vertices;
+
+	for (int i = 0; i < 1000; i++)
+		vertices.append(Ponto("", cos(i * 2 * M_PI / 1000),
+				sin(i * 2 * M_PI / 1000), 0));
+
+	Poligono poligono("poligono", vertices);
+
+	benchmark->executar("transformacao/poligono/1000", 1000,
+			[&poligono, &matriz] {
+				poligono.aplicarTransformacao(matriz);
+			});
+
+	if (!benchmark->isGrupoSelecionado("transformacao/lote/"))
+		return;
+
+	// Kernel de vértices sobre vetores contíguos, em cada conjunto de
+	// instruções e dividido entre threads
+	const unsigned int numVertices = 1000000;
+	const char* const nomes[] = { "escalar", "sse2", "avx2", "paralelo" };
+
+	std::vector<double> x(numVertices), y(numVertices), z(numVertices);
+
+	for (unsigned int i = 0; i < numVertices; i++) {
+		x[i] = i % 1000;
+		y[i] = i / 1000;
+		z[i] = 1;
+	}
+
+	KernelsVertices::ConjuntoInstrucoes conjuntoOriginal =
+			KernelsVertices::getConjuntoInstrucoes();
+	bool paraleloOriginal = KernelsVertices::isParalelo();
+
+	// Referência escalar de uma transformação das coordenadas iniciais, para
+	// a verificação dos demais kernels (as medições alteram x, y e z)
+	const std::vector<double> iniciais[3] = { x, y, z };
+	std::vector<double> referencia[3] = { x, y, z };
+	KernelsVertices::setConjuntoInstrucoes(KernelsVertices::ESCALAR);
+	KernelsVertices::setParalelo(false);
+	KernelsVertices::transformar(matriz, referencia[0].data(),
+			referencia[1].data(), referencia[2].data(), numVertices);
+
+	for (int k = 0; k < 4; k++) {
+		if (k < 3 && k > KernelsVertices::detectarSuporte())
+			continue;
+
+		String nome = String("transformacao/lote/") + nomes[k] + "/1000000";
+
+		if (!benchmark->isSelecionado(nome))
+			continue;
+
+		KernelsVertices::setConjuntoInstrucoes(k < 3 ?
+				(KernelsVertices::ConjuntoInstrucoes) k :
+				KernelsVertices::detectarSuporte());
+		KernelsVertices::setParalelo(k == 3);
+
+		// Os kernels devem reproduzir a versão escalar bit a bit
+		std::vector<double> resultado[3] = { iniciais[0], iniciais[1],
+				iniciais[2] };
+		KernelsVertices::transformar(matriz, resultado[0].data(),
+				resultado[1].data(), resultado[2].data(), numVertices);
+
+		for (int c = 0; c < 3; c++)
+			if (memcmp(resultado[c].data(), referencia[c].data(),
+					numVertices * sizeof(double)) != 0) {
+				benchmark->registrarFalha(nome,
+						"coordenadas diferentes da versao escalar");
+				break;
+			}
+
+		benchmark->executar(nome, numVertices, [&] {
+			KernelsVertices::transformar(matriz, x.data(), y.data(), z.data(),
+					numVertices);
+		});
+	}
+
+	KernelsVertices::setConjuntoInstrucoes(conjuntoOriginal);
+	KernelsVertices::setParalelo(paraleloOriginal);
+}
+
+void Casos::executarTriangulacao(Benchmark* benchmark) {
+	if (benchmark->isSelecionado("triangulacao/cristo")) {
+		Mundo mundo;
+
+		if (Casos::carregarCena(ArquivoOBJ::CRISTO_REDENTOR, 0, &mundo)) {
+			std::vector<QList<Ponto> > facetas;
+
+			for (ObjetoGeometrico* objeto : mundo.getObjetosReais())
+				if (objeto->getTipo() == ObjetoGeometrico::OBJETO3D) {
+					const Malha& malha = ((Objeto3D*) objeto)->getMalha();
+
+					for (int f = 0; f < malha.getNumFacetas(); f++)
+						facetas.push_back(malha.getPontosFaceta(f));
+				}
+
+			benchmark->executar("triangulacao/cristo", facetas.size(),
+					[&facetas] {
+						double soma = 0;
+
+						for (const QList<Ponto>& pontos : facetas)
+							soma += Triangulador::triangular(pontos).size();
+
+						Benchmark::consumir(soma);
+					});
+		}
+	}
+
+	// Estrela com 1000 vértices: metade deles côncavos
+	QList<Ponto> estrela;
+
+	for (int i = 0; i < 1000; i++) {
+		double raio = i % 2 ? 0.5 : 1;
+		estrela.append(Ponto("", raio * cos(i * 2 * M_PI / 1000),
+				raio * sin(i * 2 * M_PI / 1000), 0));
+	}
+
+	benchmark->executar("triangulacao/poligono_concavo/1000", 1000,
+			[&estrela] {
+				Benchmark::consumir(Triangulador::triangular(estrela).size());
+			});
+}
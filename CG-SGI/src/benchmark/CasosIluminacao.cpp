@@ -0,0 +1,106 @@
+#include "benchmark/Casos.h"
+#include "gui/Iluminador.h"
+#include "gui/KernelsFragmentos.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+static const char* NOMES_CONJUNTOS[] = { "escalar", "sse2", "avx2" };
+
+static void iluminarQuadro(const Iluminador& iluminador,
+		const unsigned int largura, const unsigned int altura,
+		const std::vector<float>& profundidade,
+		const std::vector<signed char>& normalX,
+		const std::vector<signed char>& normalY,
+		const std::vector<signed char>& normalZ,
+		const std::vector<QRgb>& albedos, std::vector<QRgb>* destino) {
+	for (unsigned int y = 0; y < altura; y++) {
+		unsigned int i = y * largura;
+		iluminador.iluminarSequencia(0, y, largura, &profundidade[i],
+				&normalX[i], &normalY[i], &normalZ[i], &albedos[i],
+				&(*destino)[i]);
+	}
+}
+
+static int diferencaMaxima(const std::vector<QRgb>& a,
+		const std::vector<QRgb>& b) {
+	int maxima = 0;
+
+	for (unsigned int i = 0; i < a.size(); i++) {
+		int canais[3] = { std::abs(qRed(a[i]) - qRed(b[i])), std::abs(
+				qGreen(a[i]) - qGreen(b[i])), std::abs(
+				qBlue(a[i]) - qBlue(b[i])) };
+
+		for (int c = 0; c < 3; c++)
+			if (canais[c] > maxima)
+				maxima = canais[c];
+	}
+
+	return maxima;
+}
+
+void Casos::executarIluminacao(Benchmark* benchmark) {
+	if (!benchmark->isGrupoSelecionado("iluminacao/"))
+		return;
+
+	unsigned int largura = 1024;
+	unsigned int altura = 768;
+	unsigned int total = largura * altura;
+
+	std::vector<float> profundidade(total);
+	std::vector<signed char> normalX(total), normalY(total), normalZ(total);
+	std::vector<QRgb> albedos(total);
+	std::srand(1);
+
+	for (unsigned int i = 0; i < total; i++) {
+		double nX = std::rand() / (double) RAND_MAX - 0.5;
+		double nY = std::rand() / (double) RAND_MAX - 0.5;
+		double nZ = -std::rand() / (double) RAND_MAX - 0.1;
+		double comprimento = sqrt(nX * nX + nY * nY + nZ * nZ);
+
+		profundidade[i] = std::rand() / (float) RAND_MAX;
+		normalX[i] = (signed char) lround(nX / comprimento * 127);
+		normalY[i] = (signed char) lround(nY / comprimento * 127);
+		normalZ[i] = (signed char) lround(nZ / comprimento * 127);
+		albedos[i] = qRgb(std::rand() % 256, std::rand() % 256,
+				std::rand() % 256);
+	}
+
+	Iluminador iluminador(largura, altura);
+	KernelsFragmentos::ConjuntoInstrucoes suportado =
+			KernelsFragmentos::detectarSuporte();
+	std::vector<QRgb> referencia(total), resultado(total);
+
+	// Referência escalar para a verificação dos kernels vetoriais, calculada
+	// fora das medições
+	KernelsFragmentos::setConjuntoInstrucoes(KernelsFragmentos::ESCALAR);
+	iluminarQuadro(iluminador, largura, altura, profundidade, normalX,
+			normalY, normalZ, albedos, &referencia);
+
+	for (int conjunto = KernelsFragmentos::ESCALAR; conjunto <= suportado;
+			conjunto++) {
+		KernelsFragmentos::setConjuntoInstrucoes(
+				(KernelsFragmentos::ConjuntoInstrucoes) conjunto);
+		std::string nome = std::string("iluminacao/")
+				+ NOMES_CONJUNTOS[conjunto] + "/" + std::to_string(largura)
+				+ "x" + std::to_string(altura);
+
+		if (!benchmark->isSelecionado(nome))
+			continue;
+
+		benchmark->executar(nome, total, [&] {
+			iluminarQuadro(iluminador, largura, altura, profundidade,
+					normalX, normalY, normalZ, albedos, &resultado);
+		});
+
+		// Os kernels vetoriais devem reproduzir a versão escalar bit a bit
+		int diferenca = diferencaMaxima(referencia, resultado);
+
+		if (diferenca != 0)
+			benchmark->registrarFalha(nome, "diferenca maxima "
+					+ std::to_string(diferenca) + " LSB da versao escalar");
+	}
+
+	KernelsFragmentos::setConjuntoInstrucoes(suportado);
+}
@@ -0,0 +1,175 @@
+#include "benchmark/Casos.h"
+#include "gui/clipping/ClippingCohenSutherland.h"
+#include "gui/clipping/ClippingLiangBarsky.h"
+#include "gui/FrameBuffer.h"
+#include "gui/rasterizacao/RasterizadorScanline.h"
+#include "gui/rasterizacao/RasterizadorSemiPlano.h"
+#include "gui/Renderizador.h"
+#include "persistencia/ArquivoOBJ.h"
+
+#include <cstdlib>
+#include <vector>
+
+/**
+ * Dimensões da viewport da interface, utilizadas nos casos isolados.
+ */
+static const unsigned int LARGURA = 475;
+static const unsigned int ALTURA = 555;
+static const unsigned int MARGEM = 20;
+
+void Casos::executarClipping(Benchmark* benchmark) {
+	// Retas aleatórias em [-1.5, 1.5]: parte dentro, parte cruzando a borda
+	// e parte fora da área de clipping
+	std::vector<Reta> retas;
+	std::srand(1);
+
+	for (int i = 0; i < 10000; i++) {
+		double c[4];
+
+		for (int j = 0; j < 4; j++)
+			c[j] = 3.0 * std::rand() / RAND_MAX - 1.5;
+
+		retas.push_back(Reta("reta", Ponto("", c[0], c[1], 0),
+				Ponto("", c[2], c[3], 0)));
+	}
+
+	// Mesma área de clipping do renderizador para a viewport da interface
+	double xvMin = 2.0 * MARGEM / LARGURA - 1;
+	double xvMax = 2.0 * (LARGURA - MARGEM) / LARGURA - 1;
+	double yvMin = 2.0 * MARGEM / ALTURA - 1;
+	double yvMax = 2.0 * (ALTURA - MARGEM - 1) / ALTURA - 1;
+	ClippingCohenSutherland cohenSutherland(xvMin, xvMax, yvMin, yvMax);
+	ClippingLiangBarsky liangBarsky(xvMin, xvMax, yvMin, yvMax);
+	const Clipping* algoritmos[2] = { &cohenSutherland, &liangBarsky };
+	const char* nomes[2] = { "clipping/cohen_sutherland/10000",
+			"clipping/liang_barsky/10000" };
+
+	for (int a = 0; a < 2; a++) {
+		const Clipping* clipping = algoritmos[a];
+
+		benchmark->executar(nomes[a], retas.size(), [&retas, clipping] {
+			double soma = 0;
+
+			for (const Reta& reta : retas) {
+				Reta copia(reta);
+				ObjetoGeometrico* recortada = clipping->clip(&copia);
+
+				if (recortada == 0)
+					continue;
+
+				soma += recortada->getCentroGeometrico().getX();
+
+				if (recortada != &copia)
+					delete recortada;
+			}
+
+			Benchmark::consumir(soma);
+		});
+	}
+}
+
+void Casos::executarRasterizacao(Benchmark* benchmark) {
+	if (!benchmark->isGrupoSelecionado("rasterizacao/"))
+		return;
+
+	Mundo mundo;
+
+	if (!Casos::carregarCena(ArquivoOBJ::BASIC_MAN, 250, &mundo))
+		return;
+
+	// Triângulos das facetas normalizadas, sem clipping (a área de
+	// rasterização limita os fragmentos à imagem)
+	QVector<Poligono> triangulos;
+
+	for (ObjetoGeometrico* objeto : mundo.getObjetosNormalizados()) {
+		if (objeto->getTipo() != ObjetoGeometrico::OBJETO3D)
+			continue;
+
+		const Malha& malha = ((Objeto3D*) objeto)->getMalha();
+
+		for (int f = 0; f < malha.getNumFacetas(); f++) {
+			QList<Ponto> pontos = malha.getPontosFaceta(f);
+			QVector<int> indices = malha.getTriangulacao(f);
+
+			for (int k = 0; k + 2 < indices.size(); k += 3)
+				triangulos.append(Poligono("", { pontos.at(indices.at(k)),
+						pontos.at(indices.at(k + 1)),
+						pontos.at(indices.at(k + 2)) }));
+		}
+	}
+
+	FrameBuffer frameBuffer(LARGURA, ALTURA);
+	QRect area(0, 0, LARGURA, ALTURA);
+	RasterizadorScanline scanline(LARGURA, ALTURA);
+	RasterizadorSemiPlano semiPlano(LARGURA, ALTURA);
+	const Rasterizador* rasterizadores[2] = { &scanline, &semiPlano };
+	const char* nomes[2] = { "rasterizacao/scanline/basicman",
+			"rasterizacao/semiplano/basicman" };
+
+	for (int r = 0; r < 2; r++) {
+		const Rasterizador* rasterizador = rasterizadores[r];
+
+		benchmark->executar(nomes[r], triangulos.size(),
+				[&triangulos, &frameBuffer, &area, rasterizador] {
+					for (int i = 0; i < triangulos.size(); i++)
+						rasterizador->rasterizarTriangulo(triangulos.at(i),
+								i, 0, 0, -1, &frameBuffer, area);
+				}, [&frameBuffer] {
+					frameBuffer.limpar();
+				});
+	}
+
+	// Retas aleatórias dentro da imagem, pelo caminho dedicado de linhas
+	std::vector<Ponto> extremos;
+	std::srand(1);
+
+	for (int i = 0; i < 2 * 10000; i++)
+		extremos.push_back(Ponto("", 2.0 * std::rand() / RAND_MAX - 1,
+				2.0 * std::rand() / RAND_MAX - 1, (double) std::rand() / RAND_MAX));
+
+	benchmark->executar("rasterizacao/bresenham/10000", extremos.size() / 2,
+			[&extremos, &frameBuffer, &area, &scanline] {
+				for (unsigned int i = 0; i + 1 < extremos.size(); i += 2)
+					scanline.rasterizarReta(extremos[i], extremos[i + 1], i, 0,
+							0, -1, &frameBuffer, area);
+			}, [&frameBuffer] {
+				frameBuffer.limpar();
+			});
+}
+
+void Casos::executarQuadros(Benchmark* benchmark) {
+	const String cenas[2][2] = { { "basicman", ArquivoOBJ::BASIC_MAN }, {
+			"cristo", ArquivoOBJ::CRISTO_REDENTOR } };
+	const double zooms[2] = { 250, 100 };
+	const unsigned int resolucoes[3][2] = { { LARGURA, ALTURA }, { 1280, 720 },
+			{ 1920, 1080 } };
+
+	for (int c = 0; c < 2; c++) {
+		if (!benchmark->isGrupoSelecionado("quadro/" + cenas[c][0]))
+			continue;
+
+		Mundo mundo;
+
+		if (!Casos::carregarCena(cenas[c][1], zooms[c], &mundo))
+			continue;
+
+		QList<ObjetoGeometrico*> objetos = mundo.getObjetosNormalizados();
+
+		for (const unsigned int* resolucao : resolucoes) {
+			String nome = "quadro/" + cenas[c][0] + "/"
+					+ std::to_string(resolucao[0]) + "x"
+					+ std::to_string(resolucao[1]);
+
+			if (!benchmark->isSelecionado(nome))
+				continue;
+
+			Renderizador renderizador(resolucao[0], resolucao[1], MARGEM);
+			QImage imagem(resolucao[0], resolucao[1], QImage::Format_ARGB32);
+
+			benchmark->executar(nome, resolucao[0] * resolucao[1],
+					[&renderizador, &objetos, &imagem] {
+						renderizador.renderizar(objetos, &imagem);
+					});
+		}
+	}
+}
@@ -0,0 +1,119 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "benchmark/Benchmark.h"
+#include "benchmark/Casos.h"
+
+/**
+ * Suíte de benchmarks dos caminhos críticos: leitura de OBJ, display file,
+ * transformações, triangulação, clipping, rasterização, iluminação e
+ * quadros completos. Deve ser executada no diretório que contém samples/.
+ *
+ * Uso: Benchmark.app [opções]
+ *   --repeticoes=N          repetições medidas de cada caso (padrão: 15)
+ *   --tempo=S               tempo máximo, em segundos, de cada caso (2)
+ *   --filtro=prefixo        executar somente os casos com o prefixo
+ *   --saida=arquivo.json    resultados (padrão: saída padrão)
+ *
+ * Comparação: Benchmark.app --comparar referencia.json atual.json
+ *   [--limiar=F]  aumento relativo da mediana tolerado (padrão: 0.1)
+ * Termina com código 1 caso algum caso tenha regredido ou, presente na
+ * referência, não tenha sido executado.
+ *
+ * Sem --comparar, termina com código 1 caso alguma verificação falhe (por
+ * exemplo, um kernel vetorial que diverge da versão escalar).
+ */
+
+/**
+ * Obter o valor de uma opção "--nome=valor".
+ * @return o valor, ou 0 caso o argumento seja de outra opção.
+ */
+static const char* getValor(const char* argumento, const char* nome) {
+	size_t tamanho = strlen(nome);
+
+	if (strncmp(argumento, nome, tamanho) != 0 || argumento[tamanho] != '=')
+		return 0;
+
+	return argumento + tamanho + 1;
+}
+
+/**
+ * Comparar dois arquivos de resultados.
+ * @return código de saída do programa.
+ */
+static int comparar(int argc, char* argv[]) {
+	std::vector<std::string> arquivos;
+	double limiar = 0.1;
+
+	for (int i = 2; i < argc; i++) {
+		const char* valor = getValor(argv[i], "--limiar");
+
+		if (valor != 0)
+			limiar = atof(valor);
+		else
+			arquivos.push_back(argv[i]);
+	}
+
+	if (arquivos.size() != 2 || limiar < 0) {
+		fprintf(stderr, "Uso: %s --comparar referencia.json atual.json "
+				"[--limiar=F]\n", argv[0]);
+		return 2;
+	}
+
+	std::vector<Benchmark::Resultado> referencia, atuais;
+
+	for (int i = 0; i < 2; i++)
+		if (!Benchmark::ler(arquivos[i], i == 0 ? &referencia : &atuais)) {
+			fprintf(stderr, "Erro ao ler %s\n", arquivos[i].c_str());
+			return 2;
+		}
+
+	return Benchmark::comparar(referencia, atuais, limiar) > 0 ? 1 : 0;
+}
+
+int main(int argc, char* argv[]) {
+	if (argc > 1 && strcmp(argv[1], "--comparar") == 0)
+		return comparar(argc, argv);
+
+	unsigned int repeticoes = 15;
+	double tempo = 2;
+	std::string filtro;
+	std::string saida = "-";
+
+	for (int i = 1; i < argc; i++) {
+		const char* valor;
+
+		if ((valor = getValor(argv[i], "--repeticoes")) != 0)
+			repeticoes = atoi(valor);
+		else if ((valor = getValor(argv[i], "--tempo")) != 0)
+			tempo = atof(valor);
+		else if ((valor = getValor(argv[i], "--filtro")) != 0)
+			filtro = valor;
+		else if ((valor = getValor(argv[i], "--saida")) != 0)
+			saida = valor;
+		else {
+			fprintf(stderr, "Opcao invalida: %s\n", argv[i]);
+			return 2;
+		}
+	}
+
+	Benchmark benchmark(repeticoes, tempo, filtro);
+	Casos::executarPersistencia(&benchmark);
+	Casos::executarDisplayFile(&benchmark);
+	Casos::executarTransformacao(&benchmark);
+	Casos::executarTriangulacao(&benchmark);
+	Casos::executarClipping(&benchmark);
+	Casos::executarRasterizacao(&benchmark);
+	Casos::executarIluminacao(&benchmark);
+	Casos::executarQuadros(&benchmark);
+
+	if (!benchmark.gravar(saida)) {
+		fprintf(stderr, "Erro ao gravar %s\n", saida.c_str());
+		return 2;
+	}
+
+	return benchmark.getNumFalhas() > 0 ? 1 : 0;
+}
@@ -2,6 +2,7 @@
 #include "controle/ControladorMundo.h"
 #include "controle/ControladorPersistencia.h"
 #include "controle/ControladorUI.h"
+#include "util/Rastreamento.h"
 
 ControladorPrincipal::ControladorPrincipal() {
 	this->controladorMundo = new ControladorMundo();
@@ -44,6 +45,10 @@ void ControladorPrincipal::reiniciarVisualizacao() {
 	this->controladorUI->atualizarCena(this->controladorMundo->getObjetosNormalizados());
 }
 
+void ControladorPrincipal::redesenharCena() {
+	this->controladorUI->atualizarCena(this->controladorMundo->getObjetosNormalizados());
+}
+
 void ControladorPrincipal::setProjetorVisualizacao(const Projetor::TipoProjecao& tipoProjecao) {
 	this->controladorMundo->setProjetorVisualizacao(tipoProjecao);
 	this->controladorUI->atualizarCena(this->controladorMundo->getObjetosNormalizados());
@@ -90,6 +95,7 @@ void ControladorPrincipal::rotacionarObjetoPeloCentro(const String& nome, const
 }
 
 void ControladorPrincipal::importarCena(const String& nomeArquivo) throw(ExcecaoArquivoInvalido, ExcecaoLeituraArquivo) {
+	Rastreamento::Intervalo intervalo("importar", "persistencia");
 	Cena* cena = this->controladorPersistencia->importarCena(nomeArquivo);
 	this->controladorMundo->atualizarObjetos(cena->getObjetos()); // TODO atualizar window
 	delete cena;
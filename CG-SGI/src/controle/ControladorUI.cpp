@@ -112,6 +112,10 @@ void ControladorUI::reiniciarWindow(){
 	this->controladorPrincipal->reiniciarVisualizacao();
 }
 
+void ControladorUI::redesenharCena() {
+	this->controladorPrincipal->redesenharCena();
+}
+
 void ControladorUI::atualizarCena(const QList<ObjetoGeometrico*>& objetos) {
 	this->formPrincipal->atualizarCena(objetos);
 }
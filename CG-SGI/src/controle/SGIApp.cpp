@@ -1,5 +1,10 @@
 #include "controle/SGIApp.h"
 #include "controle/ControladorPrincipal.h"
+#include "util/Log.h"
+#include "util/Rastreamento.h"
+
+#include <QtGui/qevent.h>
+#include <cstring>
 
 SGIApp::SGIApp(int argc, char *argv[]) : QApplication(argc, argv) {}
 
@@ -11,7 +16,63 @@ int SGIApp::exec() {
 	return QApplication::exec();
 }
 
+bool SGIApp::notify(QObject* destino, QEvent* evento) {
+	const char* nome = 0;
+
+	switch (evento->type()) {
+	case QEvent::KeyPress:
+		nome = "tecla";
+		break;
+	case QEvent::MouseButtonPress:
+	case QEvent::MouseButtonDblClick:
+		nome = "clique";
+		break;
+	case QEvent::MouseButtonRelease:
+		nome = "soltar";
+		break;
+	case QEvent::MouseMove:
+		// Somente arrastos, que movem os controles de zoom e rotação
+		if (((QMouseEvent*) evento)->buttons() != Qt::NoButton)
+			nome = "arrastar";
+		break;
+	case QEvent::Wheel:
+		nome = "roda";
+		break;
+	default:
+		break;
+	}
+
+	if (nome == 0 || !Rastreamento::isHabilitado())
+		return QApplication::notify(destino, evento);
+
+	Rastreamento::Intervalo intervalo(nome, "interface", evento->type());
+	return QApplication::notify(destino, evento);
+}
+
 int main(int argc, char *argv[]) {
+	String rastreamento;
+	Rastreamento::nomearThread("principal");
+
+	// --log=nivel[,categoria=nivel...] define os níveis do log, descarregado
+	// na saída de erro ao final da execução; --rastreamento=arquivo grava a
+	// linha do tempo desde o início e a exporta ao final
+	for (int i = 1; i < argc; i++) {
+		if (strncmp(argv[i], "--log=", 6) == 0 && !Log::configurar(argv[i] + 6))
+			fprintf(stderr, "Configuração de log inválida: %s\n", argv[i] + 6);
+
+		if (strncmp(argv[i], "--rastreamento=", 15) == 0) {
+			rastreamento = argv[i] + 15;
+			Rastreamento::setHabilitado(true);
+		}
+	}
+
 	SGIApp app(argc, argv);
-	return app.exec();
+	int retorno = app.exec();
+
+	if (!rastreamento.empty() && !Rastreamento::exportar(rastreamento))
+		fprintf(stderr, "Não foi possível gravar o rastreamento em %s\n",
+				rastreamento.c_str());
+
+	Log::descarregar(stderr);
+	return retorno;
 }
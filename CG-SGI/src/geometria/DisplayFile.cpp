@@ -5,10 +5,14 @@ DisplayFile::DisplayFile() {}
 DisplayFile::~DisplayFile() {}
 
 DisplayFile& DisplayFile::operator=(const DisplayFile& displayFile) {
-	for(unsigned int i = 0; i < displayFile.getTamanho(); i++) {
-		ObjetoGeometrico* obj = displayFile.objetos.values().at(i);
+	if(this == &displayFile)
+		return *this;
+
+	this->removerObjetos();
+
+	for(ObjetoGeometrico* obj : displayFile.objetos)
 		this->inserirObjeto(*obj);
-	}
+
 	return *this;
 }
 
@@ -42,23 +46,29 @@ void DisplayFile::inserirObjeto(const ObjetoGeometrico& objeto) {
 		default:
 			return;
 	}
+
+	// Um objeto de mesmo nome é substituído
+	ObjetoGeometrico* anterior = this->objetos.value(obj->getNome());
+
+	if(anterior)
+		delete anterior;
+
 	this->objetos.insert(obj->getNome(), obj);
 }
 
 void DisplayFile::removerObjeto(const String& nome) {
-	ObjetoGeometrico* obj = this->objetos[nome];
-	this->objetos.remove(nome);
+	ObjetoGeometrico* obj = this->objetos.take(nome);
 
 	if(obj)
 		delete obj;
 }
 
 ObjetoGeometrico* DisplayFile::getObjeto(const String& nome) {
-	return this->objetos[nome];
+	return this->objetos.value(nome);
 }
 
 ObjetoGeometrico* DisplayFile::getObjeto(const unsigned int posicao) {
-	return this->getObjetos().at(posicao);
+	return (this->objetos.constBegin() + posicao).value();
 }
 
 unsigned int DisplayFile::getTamanho() const {
@@ -74,8 +84,8 @@ QList<ObjetoGeometrico*> DisplayFile::getObjetos() const {
 }
 
 void DisplayFile::removerObjetos() {
-	for(String chave : this->objetos.keys()) {
-		delete this->objetos.value(chave);
-	}
+	for(ObjetoGeometrico* obj : this->objetos)
+		delete obj;
+
 	this->objetos.clear();
 }
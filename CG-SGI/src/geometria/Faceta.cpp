@@ -30,3 +30,20 @@ QList<Ponto> Faceta::getPontos() const {
 QList<Ponto*> Faceta::getPontosObjeto() {
 	return this->pontos;
 }
+
+Ponto Faceta::calcularVetorNormal(const QList<Ponto>& pontos) {
+	double x = 0;
+	double y = 0;
+	double z = 0;
+
+	// Método de Newell: robusto para polígonos côncavos ou quase planares
+	for (int i = 0, j = pontos.size() - 1; i < pontos.size(); j = i++) {
+		const Ponto& a = pontos.at(j);
+		const Ponto& b = pontos.at(i);
+		x += (a.getY() - b.getY()) * (a.getZ() + b.getZ());
+		y += (a.getZ() - b.getZ()) * (a.getX() + b.getX());
+		z += (a.getX() - b.getX()) * (a.getY() + b.getY());
+	}
+
+	return Ponto("", x, y, z);
+}
@@ -0,0 +1,337 @@
+#include "geometria/KernelsVertices.h"
+#include "util/PoolThreads.h"
+
+#include <mutex>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define KERNELS_X86
+#include <immintrin.h>
+#endif
+
+KernelsVertices::ConjuntoInstrucoes KernelsVertices::conjunto =
+		KernelsVertices::detectarSuporte();
+bool KernelsVertices::paralelo = true;
+
+/**
+ * Kernel escalar, sobre coordenadas em precisão dupla ou simples; os
+ * cálculos são sempre feitos em precisão dupla.
+ */
+template<typename T>
+static void transformarEscalar(const double m[4][4], T* const x, T* const y,
+		T* const z, const unsigned int n, const bool projecao) {
+	for (unsigned int i = 0; i < n; i++) {
+		double xi = x[i];
+		double yi = y[i];
+		double zi = z[i];
+		double tX = xi * m[0][0] + yi * m[1][0] + zi * m[2][0] + m[3][0];
+		double tY = xi * m[0][1] + yi * m[1][1] + zi * m[2][1] + m[3][1];
+		double tZ = xi * m[0][2] + yi * m[1][2] + zi * m[2][2] + m[3][2];
+
+		if (projecao) {
+			double w = xi * m[0][3] + yi * m[1][3] + zi * m[2][3] + m[3][3];
+			tX = tX / w;
+			tY = tY / w;
+		}
+
+		x[i] = tX;
+		y[i] = tY;
+		z[i] = tZ;
+	}
+}
+
+#ifdef KERNELS_X86
+
+__attribute__((target("sse2")))
+static void transformarSse2(const double m[4][4], double* const x,
+		double* const y, double* const z, const unsigned int n,
+		const bool projecao) {
+	__m128d c[4][4];
+
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			c[i][j] = _mm_set1_pd(m[i][j]);
+
+	unsigned int i = 0;
+
+	for (; i + 2 <= n; i += 2) {
+		__m128d vX = _mm_loadu_pd(x + i);
+		__m128d vY = _mm_loadu_pd(y + i);
+		__m128d vZ = _mm_loadu_pd(z + i);
+		__m128d t[4];
+
+		for (int j = 0; j < (projecao ? 4 : 3); j++)
+			t[j] = _mm_add_pd(
+					_mm_add_pd(
+							_mm_add_pd(_mm_mul_pd(vX, c[0][j]),
+									_mm_mul_pd(vY, c[1][j])),
+							_mm_mul_pd(vZ, c[2][j])), c[3][j]);
+
+		if (projecao) {
+			t[0] = _mm_div_pd(t[0], t[3]);
+			t[1] = _mm_div_pd(t[1], t[3]);
+		}
+
+		_mm_storeu_pd(x + i, t[0]);
+		_mm_storeu_pd(y + i, t[1]);
+		_mm_storeu_pd(z + i, t[2]);
+	}
+
+	// Vértice restante, fora de um grupo completo de 2
+	if (i < n)
+		transformarEscalar(m, x + i, y + i, z + i, n - i, projecao);
+}
+
+__attribute__((target("avx2")))
+static void transformarAvx2(const double m[4][4], double* const x,
+		double* const y, double* const z, const unsigned int n,
+		const bool projecao) {
+	__m256d c[4][4];
+
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			c[i][j] = _mm256_set1_pd(m[i][j]);
+
+	unsigned int i = 0;
+
+	for (; i + 4 <= n; i += 4) {
+		__m256d vX = _mm256_loadu_pd(x + i);
+		__m256d vY = _mm256_loadu_pd(y + i);
+		__m256d vZ = _mm256_loadu_pd(z + i);
+		__m256d t[4];
+
+		for (int j = 0; j < (projecao ? 4 : 3); j++)
+			t[j] = _mm256_add_pd(
+					_mm256_add_pd(
+							_mm256_add_pd(_mm256_mul_pd(vX, c[0][j]),
+									_mm256_mul_pd(vY, c[1][j])),
+							_mm256_mul_pd(vZ, c[2][j])), c[3][j]);
+
+		if (projecao) {
+			t[0] = _mm256_div_pd(t[0], t[3]);
+			t[1] = _mm256_div_pd(t[1], t[3]);
+		}
+
+		_mm256_storeu_pd(x + i, t[0]);
+		_mm256_storeu_pd(y + i, t[1]);
+		_mm256_storeu_pd(z + i, t[2]);
+	}
+
+	// Vértices restantes, fora de um grupo completo de 4
+	if (i < n)
+		transformarEscalar(m, x + i, y + i, z + i, n - i, projecao);
+}
+
+__attribute__((target("sse2")))
+static void transformarSse2(const double m[4][4], float* const x,
+		float* const y, float* const z, const unsigned int n,
+		const bool projecao) {
+	__m128d c[4][4];
+
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			c[i][j] = _mm_set1_pd(m[i][j]);
+
+	unsigned int i = 0;
+
+	// Quatro vértices por passo, convertidos para precisão dupla em duas
+	// metades e arredondados de volta somente no resultado
+	for (; i + 4 <= n; i += 4) {
+		__m128 entrada[3] = { _mm_loadu_ps(x + i), _mm_loadu_ps(y + i),
+				_mm_loadu_ps(z + i) };
+		__m128 saida[3];
+		__m128d metades[2][3];
+
+		for (int k = 0; k < 3; k++) {
+			metades[0][k] = _mm_cvtps_pd(entrada[k]);
+			metades[1][k] = _mm_cvtps_pd(_mm_movehl_ps(entrada[k], entrada[k]));
+		}
+
+		__m128d t[2][4];
+
+		for (int h = 0; h < 2; h++) {
+			for (int j = 0; j < (projecao ? 4 : 3); j++)
+				t[h][j] = _mm_add_pd(
+						_mm_add_pd(
+								_mm_add_pd(_mm_mul_pd(metades[h][0], c[0][j]),
+										_mm_mul_pd(metades[h][1], c[1][j])),
+								_mm_mul_pd(metades[h][2], c[2][j])), c[3][j]);
+
+			if (projecao) {
+				t[h][0] = _mm_div_pd(t[h][0], t[h][3]);
+				t[h][1] = _mm_div_pd(t[h][1], t[h][3]);
+			}
+		}
+
+		for (int k = 0; k < 3; k++)
+			saida[k] = _mm_movelh_ps(_mm_cvtpd_ps(t[0][k]),
+					_mm_cvtpd_ps(t[1][k]));
+
+		_mm_storeu_ps(x + i, saida[0]);
+		_mm_storeu_ps(y + i, saida[1]);
+		_mm_storeu_ps(z + i, saida[2]);
+	}
+
+	// Vértices restantes, fora de um grupo completo de 4
+	if (i < n)
+		transformarEscalar(m, x + i, y + i, z + i, n - i, projecao);
+}
+
+__attribute__((target("avx2")))
+static void transformarAvx2(const double m[4][4], float* const x,
+		float* const y, float* const z, const unsigned int n,
+		const bool projecao) {
+	__m256d c[4][4];
+
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			c[i][j] = _mm256_set1_pd(m[i][j]);
+
+	unsigned int i = 0;
+
+	for (; i + 4 <= n; i += 4) {
+		__m256d vX = _mm256_cvtps_pd(_mm_loadu_ps(x + i));
+		__m256d vY = _mm256_cvtps_pd(_mm_loadu_ps(y + i));
+		__m256d vZ = _mm256_cvtps_pd(_mm_loadu_ps(z + i));
+		__m256d t[4];
+
+		for (int j = 0; j < (projecao ? 4 : 3); j++)
+			t[j] = _mm256_add_pd(
+					_mm256_add_pd(
+							_mm256_add_pd(_mm256_mul_pd(vX, c[0][j]),
+									_mm256_mul_pd(vY, c[1][j])),
+							_mm256_mul_pd(vZ, c[2][j])), c[3][j]);
+
+		if (projecao) {
+			t[0] = _mm256_div_pd(t[0], t[3]);
+			t[1] = _mm256_div_pd(t[1], t[3]);
+		}
+
+		_mm_storeu_ps(x + i, _mm256_cvtpd_ps(t[0]));
+		_mm_storeu_ps(y + i, _mm256_cvtpd_ps(t[1]));
+		_mm_storeu_ps(z + i, _mm256_cvtpd_ps(t[2]));
+	}
+
+	// Vértices restantes, fora de um grupo completo de 4
+	if (i < n)
+		transformarEscalar(m, x + i, y + i, z + i, n - i, projecao);
+}
+
+#endif /* KERNELS_X86 */
+
+/**
+ * Transformar um bloco de vértices com o conjunto de instruções em uso.
+ */
+template<typename T>
+static void transformarBloco(const KernelsVertices::ConjuntoInstrucoes conjunto,
+		const double m[4][4], T* const x, T* const y, T* const z,
+		const unsigned int n, const bool projecao) {
+	switch (conjunto) {
+#ifdef KERNELS_X86
+	case KernelsVertices::AVX2:
+		transformarAvx2(m, x, y, z, n, projecao);
+		break;
+	case KernelsVertices::SSE2:
+		transformarSse2(m, x, y, z, n, projecao);
+		break;
+#endif
+	default:
+		transformarEscalar(m, x, y, z, n, projecao);
+		break;
+	}
+}
+
+/**
+ * Trava do conjunto de threads dos lotes paralelos.
+ */
+static std::mutex mutexPool;
+
+/**
+ * Conjunto de threads dos lotes paralelos, compartilhado pelas duas
+ * precisões e criado no primeiro lote paralelo.
+ */
+static PoolThreads& getPool() {
+	static PoolThreads pool;
+	return pool;
+}
+
+/**
+ * Transformar um lote, dividindo-o em blocos entre as threads quando grande.
+ */
+template<typename T>
+static void transformarLote(const KernelsVertices::ConjuntoInstrucoes conjunto,
+		const bool paralelo, const double m[4][4], T* const x, T* const y,
+		T* const z, const unsigned int n, const bool projecao) {
+	if (!paralelo || n < KernelsVertices::MINIMO_PARALELO) {
+		transformarBloco(conjunto, m, x, y, z, n, projecao);
+		return;
+	}
+
+	// Outra thread usando o conjunto: o lote é executado por esta mesma
+	std::unique_lock<std::mutex> trava(mutexPool, std::try_to_lock);
+
+	if (!trava.owns_lock()) {
+		transformarBloco(conjunto, m, x, y, z, n, projecao);
+		return;
+	}
+
+	const unsigned int tamanho = KernelsVertices::TAMANHO_BLOCO;
+
+	getPool().executar((n + tamanho - 1) / tamanho, [&](unsigned int bloco) {
+		unsigned int inicio = bloco * tamanho;
+		unsigned int fim = inicio + tamanho < n ? inicio + tamanho : n;
+		transformarBloco(conjunto, m, x + inicio, y + inicio, z + inicio,
+				fim - inicio, projecao);
+	});
+}
+
+KernelsVertices::ConjuntoInstrucoes KernelsVertices::detectarSuporte() {
+#ifdef KERNELS_X86
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx2"))
+		return AVX2;
+
+	if (__builtin_cpu_supports("sse2"))
+		return SSE2;
+#endif
+
+	return ESCALAR;
+}
+
+KernelsVertices::ConjuntoInstrucoes KernelsVertices::getConjuntoInstrucoes() {
+	return conjunto;
+}
+
+void KernelsVertices::setConjuntoInstrucoes(
+		const ConjuntoInstrucoes conjunto) {
+	ConjuntoInstrucoes suportado = detectarSuporte();
+	KernelsVertices::conjunto = conjunto > suportado ? suportado : conjunto;
+}
+
+bool KernelsVertices::isParalelo() {
+	return paralelo;
+}
+
+void KernelsVertices::setParalelo(const bool paralelo) {
+	KernelsVertices::paralelo = paralelo;
+}
+
+void KernelsVertices::transformar(const double matriz[4][4], double* const x,
+		double* const y, double* const z, const unsigned int n) {
+	transformarLote(conjunto, paralelo, matriz, x, y, z, n, false);
+}
+
+void KernelsVertices::projetar(const double matriz[4][4], double* const x,
+		double* const y, double* const z, const unsigned int n) {
+	transformarLote(conjunto, paralelo, matriz, x, y, z, n, true);
+}
+
+void KernelsVertices::transformar(const double matriz[4][4], float* const x,
+		float* const y, float* const z, const unsigned int n) {
+	transformarLote(conjunto, paralelo, matriz, x, y, z, n, false);
+}
+
+void KernelsVertices::projetar(const double matriz[4][4], float* const x,
+		float* const y, float* const z, const unsigned int n) {
+	transformarLote(conjunto, paralelo, matriz, x, y, z, n, true);
+}
@@ -0,0 +1,330 @@
+#include "geometria/Malha.h"
+#include "geometria/KernelsVertices.h"
+#include "geometria/Triangulador.h"
+
+#include <QtCore/qmap.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+Malha::Malha() :
+		topologia(new Topologia), atributos(new Atributos) {
+	this->topologia->inicios.append(0);
+	this->topologia->iniciosTriangulos.append(0);
+}
+
+Malha::Malha(const QList<Ponto*>& pontos, const QList<Faceta>& facetas) :
+		topologia(new Topologia), atributos(new Atributos) {
+	Topologia* t = this->topologia.data();
+	QVector<float>& posicoes = this->atributos->posicoes;
+	QMap<long, int> indicesPontos;
+
+	int n = pontos.size();
+	posicoes.resize(3 * n);
+
+	for (int i = 0; i < n; i++) {
+		const Ponto* p = pontos.at(i);
+		indicesPontos.insert((long) p, i);
+		posicoes[i] = p->getX();
+		posicoes[n + i] = p->getY();
+		posicoes[2 * n + i] = p->getZ();
+	}
+
+	t->inicios.reserve(facetas.size() + 1);
+	t->materiais.reserve(facetas.size());
+	t->inicios.append(0);
+
+	for (Faceta face : facetas) {
+		for (Ponto* p : face.getPontosObjeto())
+			t->indices.append(indicesPontos.value((long) p));
+
+		t->inicios.append(t->indices.size());
+
+		// Poucos materiais por malha: a busca linear basta
+		int material = t->cores.indexOf(face.getCor());
+
+		if (material < 0) {
+			material = t->cores.size();
+			t->cores.append(face.getCor());
+		}
+
+		t->materiais.append(material);
+	}
+
+	t->iniciosTriangulos.append(0);
+}
+
+int Malha::getNumVertices() const {
+	return this->atributos->posicoes.size() / 3;
+}
+
+int Malha::getNumFacetas() const {
+	return this->topologia->materiais.size();
+}
+
+Ponto Malha::getVertice(const int vertice) const {
+	const float* p = this->atributos->posicoes.constData() + vertice;
+	int n = this->getNumVertices();
+	return Ponto("", p[0], p[n], p[2 * n]);
+}
+
+QList<Ponto> Malha::getPontosFaceta(const int faceta) const {
+	const Topologia* t = this->topologia.constData();
+	QList<Ponto> lista;
+
+	for (int k = t->inicios.at(faceta); k < t->inicios.at(faceta + 1); k++)
+		lista.append(this->getVertice(t->indices.at(k)));
+
+	return lista;
+}
+
+QVector<int> Malha::getIndicesFaceta(const int faceta) const {
+	const Topologia* t = this->topologia.constData();
+	int inicio = t->inicios.at(faceta);
+	return t->indices.mid(inicio, t->inicios.at(faceta + 1) - inicio);
+}
+
+QColor Malha::getCor(const int faceta) const {
+	return this->topologia->cores.at(this->topologia->materiais.at(faceta));
+}
+
+Ponto Malha::getNormal(const int faceta) const {
+	const float* n = this->atributos->normais.constData() + 3 * faceta;
+	return Ponto("", n[0], n[1], n[2]);
+}
+
+double Malha::getArea(const int faceta) const {
+	return this->atributos->areas.at(faceta);
+}
+
+QList<Ponto> Malha::getNormaisVertices(const int faceta) const {
+	const Topologia* t = this->topologia.constData();
+	const QVector<float>& normaisVertices = this->atributos->normaisVertices;
+	QList<Ponto> lista;
+
+	if (normaisVertices.isEmpty())
+		return lista;
+
+	for (int k = t->inicios.at(faceta); k < t->inicios.at(faceta + 1); k++) {
+		const float* n = normaisVertices.constData() + 3 * t->indices.at(k);
+		lista.append(Ponto("", n[0], n[1], n[2]));
+	}
+
+	return lista;
+}
+
+QVector<int> Malha::getTriangulacao(const int faceta) const {
+	const Topologia* t = this->topologia.constData();
+	int inicio = t->iniciosTriangulos.at(faceta);
+	return t->triangulos.mid(inicio,
+			t->iniciosTriangulos.at(faceta + 1) - inicio);
+}
+
+QVector<int> Malha::getArestas() const {
+	return this->topologia->arestas;
+}
+
+bool Malha::isFechada() const {
+	QVector<long long> chaves = this->chavesArestas();
+
+	for (int i = 0; i < chaves.size(); i += 2)
+		if (i + 1 >= chaves.size() || chaves.at(i) != chaves.at(i + 1)
+				|| (i + 2 < chaves.size() && chaves.at(i + 2) == chaves.at(i)))
+			return false;
+
+	return !chaves.isEmpty();
+}
+
+void Malha::aplicarTransformacao(const double matriz[4][4]) {
+	this->transformarVertices(matriz, false);
+
+	// Transformação afim: as normais são levadas pela matriz de cofatores da
+	// parte linear, sem recalculá-las a partir dos vértices
+	Atributos* a = this->atributos.data();
+	double c[3][3];
+
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 3; j++) {
+			int i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+			int j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+			c[i][j] = matriz[i1][j1] * matriz[i2][j2]
+					- matriz[i1][j2] * matriz[i2][j1];
+		}
+
+	float* normais[2] = { a->normais.data(), a->normaisVertices.data() };
+	int quantidades[2] = { a->normais.size() / 3, a->normaisVertices.size()
+			/ 3 };
+
+	for (int v = 0; v < 2; v++)
+		for (int i = 0; i < quantidades[v]; i++) {
+			float* n = normais[v] + 3 * i;
+			double x = n[0], y = n[1], z = n[2];
+			double nX = x * c[0][0] + y * c[1][0] + z * c[2][0];
+			double nY = x * c[0][1] + y * c[1][1] + z * c[2][1];
+			double nZ = x * c[0][2] + y * c[1][2] + z * c[2][2];
+			double comprimento = sqrt(nX * nX + nY * nY + nZ * nZ);
+
+			// O vetor de Newell da faceta transformada é o original vezes os
+			// cofatores: a área escala com o comprimento da normal
+			if (v == 0)
+				a->areas[i] *= comprimento;
+
+			if (comprimento == 0)
+				comprimento = 1;
+
+			n[0] = nX / comprimento;
+			n[1] = nY / comprimento;
+			n[2] = nZ / comprimento;
+		}
+}
+
+void Malha::aplicarProjecao(const double matriz[4][4]) {
+	this->transformarVertices(matriz, true);
+}
+
+void Malha::atualizarNormais(const bool normaisVertices) {
+	// Somente os atributos são alterados: a topologia segue compartilhada
+	const Topologia* t = this->topologia.constData();
+	Atributos* a = this->atributos.data();
+	int numFacetas = t->materiais.size();
+	int n = a->posicoes.size() / 3;
+	const float* px = a->posicoes.constData();
+	const float* py = px + n;
+	const float* pz = py + n;
+	std::vector<double> somas(normaisVertices ? a->posicoes.size() : 0);
+
+	a->normais.resize(3 * numFacetas);
+	a->areas.resize(numFacetas);
+
+	for (int f = 0; f < numFacetas; f++) {
+		int inicio = t->inicios.at(f);
+		int fim = t->inicios.at(f + 1);
+		double x = 0, y = 0, z = 0;
+
+		// Método de Newell, como em Faceta::calcularVetorNormal
+		for (int i = inicio, j = fim - 1; i < fim; j = i++) {
+			int u = t->indices.at(j);
+			int v = t->indices.at(i);
+			x += ((double) py[u] - py[v]) * ((double) pz[u] + pz[v]);
+			y += ((double) pz[u] - pz[v]) * ((double) px[u] + px[v]);
+			z += ((double) px[u] - px[v]) * ((double) py[u] + py[v]);
+		}
+
+		// O módulo do vetor de Newell é o dobro da área da faceta
+		double comprimento = sqrt(x * x + y * y + z * z);
+		double area = comprimento / 2;
+		a->areas[f] = area;
+
+		if (comprimento == 0)
+			comprimento = 1;
+
+		x /= comprimento;
+		y /= comprimento;
+		z /= comprimento;
+		a->normais[3 * f] = x;
+		a->normais[3 * f + 1] = y;
+		a->normais[3 * f + 2] = z;
+
+		if (!normaisVertices)
+			continue;
+
+		for (int k = inicio; k < fim; k++) {
+			double* soma = &somas[3 * t->indices.at(k)];
+			soma[0] += x * area;
+			soma[1] += y * area;
+			soma[2] += z * area;
+		}
+	}
+
+	a->normaisVertices.resize(somas.size());
+
+	for (unsigned int i = 0; i < somas.size(); i += 3) {
+		double comprimento = sqrt(
+				somas[i] * somas[i] + somas[i + 1] * somas[i + 1]
+						+ somas[i + 2] * somas[i + 2]);
+
+		if (comprimento == 0)
+			comprimento = 1;
+
+		a->normaisVertices[i] = somas[i] / comprimento;
+		a->normaisVertices[i + 1] = somas[i + 1] / comprimento;
+		a->normaisVertices[i + 2] = somas[i + 2] / comprimento;
+	}
+}
+
+void Malha::atualizarTriangulacoes() {
+	QVector<int> triangulos;
+	QVector<int> iniciosTriangulos;
+	iniciosTriangulos.append(0);
+
+	for (int f = 0; f < this->getNumFacetas(); f++) {
+		triangulos += Triangulador::triangular(this->getPontosFaceta(f));
+		iniciosTriangulos.append(triangulos.size());
+	}
+
+	this->topologia->triangulos = triangulos;
+	this->topologia->iniciosTriangulos = iniciosTriangulos;
+}
+
+void Malha::atualizarArestas() {
+	QVector<long long> chaves = this->chavesArestas();
+	QVector<int> arestas;
+
+	for (int i = 0; i < chaves.size(); i++) {
+		if (i > 0 && chaves.at(i) == chaves.at(i - 1))
+			continue;
+
+		arestas.append((int) (chaves.at(i) >> 32));
+		arestas.append((int) (chaves.at(i) & 0xFFFFFFFF));
+	}
+
+	this->topologia->arestas = arestas;
+}
+
+unsigned long Malha::getTamanhoMemoria() const {
+	const Topologia* t = this->topologia.constData();
+	const Atributos* a = this->atributos.constData();
+
+	return (t->indices.size() + t->inicios.size() + t->materiais.size()
+			+ t->triangulos.size() + t->iniciosTriangulos.size()
+			+ t->arestas.size()) * sizeof(int)
+			+ t->cores.size() * sizeof(QColor)
+			+ (a->posicoes.size() + a->normais.size() + a->areas.size()
+					+ a->normaisVertices.size()) * sizeof(float);
+}
+
+QVector<long long> Malha::chavesArestas() const {
+	const Topologia* t = this->topologia.constData();
+	QVector<long long> chaves;
+	chaves.reserve(t->indices.size());
+
+	for (int f = 0; f < t->materiais.size(); f++) {
+		int inicio = t->inicios.at(f);
+		int fim = t->inicios.at(f + 1);
+
+		for (int i = inicio; i < fim; i++) {
+			long long a = t->indices.at(i);
+			long long b = t->indices.at(i + 1 < fim ? i + 1 : inicio);
+			chaves.append(std::min(a, b) << 32 | std::max(a, b));
+		}
+	}
+
+	std::sort(chaves.begin(), chaves.end());
+	return chaves;
+}
+
+void Malha::transformarVertices(const double matriz[4][4],
+		const bool projecao) {
+	unsigned int n = this->getNumVertices();
+
+	// Somente aqui os atributos deixam de ser compartilhados com as cópias
+	float* x = this->atributos->posicoes.data();
+	float* y = x + n;
+	float* z = y + n;
+
+	if (projecao)
+		KernelsVertices::projetar(matriz, x, y, z, n);
+	else
+		KernelsVertices::transformar(matriz, x, y, z, n);
+}
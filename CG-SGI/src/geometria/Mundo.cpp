@@ -1,4 +1,5 @@
 #include "geometria/Mundo.h"
+#include "util/Log.h"
 
 Mundo::Mundo() {
 	this->window = new Window();
@@ -10,10 +11,7 @@ Mundo::~Mundo() {
 }
 
 void Mundo::setWindow(const Window& window) {
-	if (this->window)
-		delete this->window;
-
-	this->window = new Window(window);
+	*this->window = window;
 	this->window->atualizarDisplayFile(this->displayFile);
 }
 
@@ -26,6 +24,7 @@ QList<ObjetoGeometrico*> Mundo::getObjetosNormalizados() const {
 }
 
 void Mundo::removerObjetos() {
+	LOG_DEPURACAO(Log::MUNDO, "removendo todos os objetos");
 	this->displayFile.removerObjetos();
 	this->window->removerObjetos();
 }
@@ -64,8 +63,7 @@ void Mundo::rotacionarVisualizacao(const double angulo, const Eixo& eixo) {
 }
 
 void Mundo::reiniciarVisualizacao() {
-	delete this->window;
-	this->window = new Window();
+	*this->window = Window();
 	this->window->atualizarDisplayFile(this->displayFile);
 }
 
@@ -75,11 +73,17 @@ void Mundo::setProjetorVisualizacao(const Projetor::TipoProjecao& tipoProjecao)
 }
 
 void Mundo::inserirObjeto(const ObjetoGeometrico& objeto) {
+	LOG_DEPURACAO(Log::MUNDO, "inserindo objeto '%s' (%s)",
+			objeto.getNome().c_str(), objeto.getTipoString().c_str());
 	this->displayFile.inserirObjeto(objeto);
+
+	// Um objeto de mesmo nome pode ter outra topologia: normalizar do zero
+	this->window->removerObjeto(objeto.getNome());
 	this->window->atualizarObjeto((ObjetoGeometrico*) &objeto);
 }
 
 void Mundo::removerObjeto(const String& nome) {
+	LOG_DEPURACAO(Log::MUNDO, "removendo objeto '%s'", nome.c_str());
 	this->displayFile.removerObjeto(nome);
 	this->window->removerObjeto(nome);
 }
@@ -2,35 +2,24 @@
 
 Objeto3D::Objeto3D() :
 		ObjetoGeometrico() {
+	this->suavizado = true;
+	this->descarteFacesTraseiras = true;
 }
 
 Objeto3D::Objeto3D(const Objeto3D& objeto3d) :
-		ObjetoGeometrico(objeto3d) {
-	QMap<long, Ponto*> novosPontos;
-
-	for (int i = 0; i < objeto3d.pontos.size(); i++) {
-		Ponto* p = (Ponto*) objeto3d.pontos.at(i)->clonar();
-		novosPontos.insert((long) objeto3d.pontos.at(i), p);
-	}
-
-	this->pontos = novosPontos.values();
-
-	for (int i = 0; i < objeto3d.facetas.size(); i++) {
-		Faceta face = objeto3d.facetas.at(i);
-		QList<Ponto*> pontosFaceta;
-
-		for(Ponto *p : face.getPontosObjeto()) {
-			pontosFaceta.append(novosPontos.value((long) p));
-		}
-		this->facetas.append(Faceta(pontosFaceta, face.getCor()));
-	}
+		ObjetoGeometrico(objeto3d), malha(objeto3d.malha) {
+	this->suavizado = objeto3d.suavizado;
+	this->descarteFacesTraseiras = objeto3d.descarteFacesTraseiras;
 }
 
 Objeto3D::Objeto3D(const String& nome, const QList<Ponto*>& pontos,
 		const QList<Faceta>& facetas) :
-		ObjetoGeometrico(nome, Tipo::OBJETO3D) {
-	this->pontos = pontos;
-	this->facetas = facetas;
+		ObjetoGeometrico(nome, Tipo::OBJETO3D), malha(pontos, facetas) {
+	this->suavizado = true;
+	this->descarteFacesTraseiras = this->isFechado();
+	this->atualizarNormais();
+	this->atualizarTriangulacoes();
+	this->atualizarArestas();
 }
 
 Objeto3D::~Objeto3D() {
@@ -38,26 +27,9 @@ Objeto3D::~Objeto3D() {
 
 Objeto3D& Objeto3D::operator=(const Objeto3D& objeto3d) {
 	this->ObjetoGeometrico::operator =(objeto3d);
-	this->pontos.clear();
-	this->facetas.clear();
-	QMap<long, Ponto*> novosPontos;
-
-	for (int i = 0; i < objeto3d.pontos.size(); i++) {
-		Ponto* p = (Ponto*) objeto3d.pontos.at(i)->clonar();
-		novosPontos.insert((long) objeto3d.pontos.at(i), p);
-	}
-
-	this->pontos = novosPontos.values();
-
-	for (int i = 0; i < objeto3d.facetas.size(); i++) {
-		Faceta face = objeto3d.facetas.at(i);
-		QList<Ponto*> pontosFaceta;
-
-		for(Ponto *p : face.getPontosObjeto()) {
-			pontosFaceta.append(novosPontos.value((long) p));
-		}
-		this->facetas.append(Faceta(pontosFaceta, face.getCor()));
-	}
+	this->malha = objeto3d.malha;
+	this->suavizado = objeto3d.suavizado;
+	this->descarteFacesTraseiras = objeto3d.descarteFacesTraseiras;
 	return *this;
 }
 
@@ -68,25 +40,76 @@ ObjetoGeometrico* Objeto3D::clonar() const {
 QList<Ponto> Objeto3D::getPontos() const {
 	QList<Ponto> lista;
 
-	for (int i = 0; i < this->pontos.size(); i++)
-		lista.insert(i, *this->pontos.at(i));
+	for (int i = 0; i < this->malha.getNumVertices(); i++)
+		lista.append(this->malha.getVertice(i));
 
 	return lista;
 }
 
 QList<Ponto*> Objeto3D::getPontosObjeto() {
-	return this->pontos;
+	// Uma lista vazia descartaria em silêncio as alterações de quem chamou
+	throw ExcecaoOperacaoNaoSuportada(this->nome, "getPontosObjeto");
+}
+
+const Malha& Objeto3D::getMalha() const {
+	return this->malha;
+}
+
+void Objeto3D::aplicarTransformacao(const double matriz[4][4]) {
+	this->malha.aplicarTransformacao(matriz);
+	this->marcarAlteracao();
+}
+
+void Objeto3D::aplicarProjecao(const double matriz[4][4]) {
+	this->malha.aplicarProjecao(matriz);
+	this->atualizarNormais();
+	this->marcarAlteracao();
+}
+
+void Objeto3D::atualizarNormais() {
+	this->malha.atualizarNormais(this->suavizado);
+}
+
+void Objeto3D::atualizarTriangulacoes() {
+	this->malha.atualizarTriangulacoes();
+}
+
+void Objeto3D::atualizarArestas() {
+	this->malha.atualizarArestas();
+}
+
+QVector<int> Objeto3D::getArestas() const {
+	return this->malha.getArestas();
+}
+
+bool Objeto3D::isSuavizado() const {
+	return this->suavizado;
+}
+
+void Objeto3D::setSuavizado(const bool suavizado) {
+	this->suavizado = suavizado;
+	this->atualizarNormais();
+	this->marcarAlteracao();
+}
+
+bool Objeto3D::isFechado() const {
+	return this->malha.isFechada();
+}
+
+bool Objeto3D::isDescarteFacesTraseiras() const {
+	return this->descarteFacesTraseiras;
 }
 
-QList<Faceta> Objeto3D::getFacetas() const {
-	return this->facetas;
+void Objeto3D::setDescarteFacesTraseiras(const bool descarte) {
+	this->descarteFacesTraseiras = descarte;
+	this->marcarAlteracao();
 }
 
 const String Objeto3D::toString() const {
-	String str = this->pontos.at(0)->toString();
+	String str = this->malha.getVertice(0).toString();
 
-	for (int i = 1; i < this->pontos.size(); i++)
-		str += ", " + this->pontos.at(i)->toString();
+	for (int i = 1; i < this->malha.getNumVertices(); i++)
+		str += ", " + this->malha.getVertice(i).toString();
 
 	return "[" + str + "]";
 }
@@ -1,17 +1,64 @@
 #include "geometria/ObjetoGeometrico.h"
+#include "geometria/KernelsVertices.h"
 #include "geometria/Ponto.h"
 #include "geometria/Reta.h"
 
+#include <atomic>
+#include <vector>
+
+// Revisões são únicas entre todos os objetos, exceto as herdadas por cópia
+static std::atomic<unsigned long long> proximaRevisao(1);
+
+/**
+ * Copiar as coordenadas dos pontos para vetores contíguos, transformá-los em
+ * lote e devolver o resultado aos pontos. Somente as malhas guardam as
+ * coordenadas de forma contígua: polígonos, curvas e a window têm poucos
+ * pontos e os mantêm como objetos Ponto, expostos por getPontosObjeto.
+ */
+static void aplicarLote(const QList<Ponto*>& pontos, const double matriz[4][4],
+		const bool projecao) {
+	static thread_local std::vector<double> coordenadas;
+	unsigned int n = pontos.size();
+
+	if (coordenadas.size() < 3 * n)
+		coordenadas.resize(3 * n);
+
+	double* x = coordenadas.data();
+	double* y = x + n;
+	double* z = y + n;
+
+	for (unsigned int i = 0; i < n; i++) {
+		const Ponto* p = pontos.at(i);
+		x[i] = p->getX();
+		y[i] = p->getY();
+		z[i] = p->getZ();
+	}
+
+	if (projecao)
+		KernelsVertices::projetar(matriz, x, y, z, n);
+	else
+		KernelsVertices::transformar(matriz, x, y, z, n);
+
+	for (unsigned int i = 0; i < n; i++) {
+		Ponto* p = pontos.at(i);
+		p->setX(x[i]);
+		p->setY(y[i]);
+		p->setZ(z[i]);
+	}
+}
+
 ObjetoGeometrico::ObjetoGeometrico(const ObjetoGeometrico& objeto) {
 	this->nome = objeto.nome;
 	this->tipo = objeto.tipo;
 	this->cor = objeto.cor;
+	this->revisao = objeto.revisao;
 }
 
 ObjetoGeometrico::ObjetoGeometrico() {
 	this->nome = "";
 	this->tipo = Tipo::POLIGONO;
 	this->cor = QColor(0, 0, 0);
+	this->marcarAlteracao();
 }
 
 ObjetoGeometrico::ObjetoGeometrico(const String& nome, const Tipo tipo,
@@ -19,6 +66,7 @@ ObjetoGeometrico::ObjetoGeometrico(const String& nome, const Tipo tipo,
 	this->nome = nome;
 	this->tipo = tipo;
 	this->cor = cor;
+	this->marcarAlteracao();
 }
 
 ObjetoGeometrico::~ObjetoGeometrico() {
@@ -28,6 +76,7 @@ ObjetoGeometrico& ObjetoGeometrico::operator=(const ObjetoGeometrico& objeto) {
 	this->nome = objeto.nome;
 	this->tipo = objeto.tipo;
 	this->cor = objeto.cor;
+	this->revisao = objeto.revisao;
 	return *this;
 }
 
@@ -92,6 +141,15 @@ const Ponto ObjetoGeometrico::getCentroGeometrico() const {
 
 void ObjetoGeometrico::setCor(const QColor& cor) {
 	this->cor = cor;
+	this->marcarAlteracao();
+}
+
+unsigned long long ObjetoGeometrico::getRevisao() const {
+	return this->revisao;
+}
+
+void ObjetoGeometrico::marcarAlteracao() {
+	this->revisao = proximaRevisao.fetch_add(1, std::memory_order_relaxed);
 }
 
 void ObjetoGeometrico::escalonar(const double sX, const double sY,
@@ -190,19 +248,11 @@ void ObjetoGeometrico::rotacionarPorEixo(const double angulo,
 }
 
 void ObjetoGeometrico::aplicarTransformacao(const double matriz[4][4]) {
-	QList<Ponto*> pontos = this->getPontosObjeto();
-
-	for (int i = 0; i < pontos.size(); i++) {
-		Ponto* p = pontos.at(i);
-		double coordenadas[4] = { 0, 0, 0, 0 };
-
-		for (int j = 0; j < 4; j++) {
-			coordenadas[j] = p->getX() * matriz[0][j] + p->getY() * matriz[1][j]
-					+ p->getZ() * matriz[2][j] + 1 * matriz[3][j]; // Coordenada Homogênea
-		}
+	aplicarLote(this->getPontosObjeto(), matriz, false);
+	this->marcarAlteracao();
+}
 
-		p->setX(coordenadas[0]);
-		p->setY(coordenadas[1]);
-		p->setZ(coordenadas[2]);
-	}
+void ObjetoGeometrico::aplicarProjecao(const double matriz[4][4]) {
+	aplicarLote(this->getPontosObjeto(), matriz, true);
+	this->marcarAlteracao();
 }
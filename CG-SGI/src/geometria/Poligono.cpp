@@ -1,19 +1,34 @@
 #include "geometria/Poligono.h"
 
+#include "geometria/Triangulador.h"
+
+/**
+ * Triangulação de um triângulo, compartilhada (sem cópia) por todos eles.
+ */
+static const QVector<int>& getTriangulacaoTriangulo() {
+	static const QVector<int> triangulacao = { 0, 1, 2 };
+	return triangulacao;
+}
+
 Poligono::Poligono() :
 		ObjetoGeometrico() {
+	this->triangulacaoPendente = false;
 }
 
 Poligono::Poligono(const Poligono& poligono) :
 		ObjetoGeometrico(poligono) {
 	for (int i = 0; i < poligono.pontos.size(); i++)
 		this->pontos.insert(i, poligono.pontos.at(i));
+
+	this->triangulacao = poligono.getTriangulacao();
+	this->triangulacaoPendente = false;
 }
 
 Poligono::Poligono(const String& nome, const QList<Ponto>& pontos,
 		const QColor& cor) :
 		ObjetoGeometrico(nome, Tipo::POLIGONO, cor) {
 	this->pontos = pontos;
+	this->triangular();
 }
 
 Poligono::~Poligono() {
@@ -24,6 +39,8 @@ Poligono& Poligono::operator=(const Poligono& poligono) {
 	this->pontos.clear();
 	for (int i = 0; i < poligono.pontos.size(); i++)
 		this->pontos.insert(i, poligono.pontos.at(i));
+	this->triangulacao = poligono.getTriangulacao();
+	this->triangulacaoPendente = false;
 	return *this;
 }
 
@@ -37,6 +54,7 @@ QList<Ponto> Poligono::getPontos() const {
 
 QList<Ponto*> Poligono::getPontosObjeto() {
 	QList<Ponto*> lista;
+	this->triangulacaoPendente = true;
 
 	for (int i = 0; i < this->pontos.size(); i++)
 		lista.insert(i, (Ponto*) &this->pontos.at(i));
@@ -44,6 +62,36 @@ QList<Ponto*> Poligono::getPontosObjeto() {
 	return lista;
 }
 
+QVector<int> Poligono::getTriangulacao() const {
+	if (this->triangulacaoPendente)
+		this->triangular();
+
+	return this->triangulacao;
+}
+
+void Poligono::aplicarTransformacao(const double matriz[4][4]) {
+	// Os pontos são alterados por getPontosObjeto, mas sem mudar a topologia
+	bool pendente = this->triangulacaoPendente;
+	this->ObjetoGeometrico::aplicarTransformacao(matriz);
+	this->triangulacaoPendente = pendente;
+}
+
+void Poligono::aplicarProjecao(const double matriz[4][4]) {
+	bool pendente = this->triangulacaoPendente;
+	this->ObjetoGeometrico::aplicarProjecao(matriz);
+	this->triangulacaoPendente = pendente;
+}
+
+void Poligono::triangular() const {
+	// Triângulos dispensam o triangulador e não alocam um vetor próprio
+	if (this->pontos.size() == 3)
+		this->triangulacao = getTriangulacaoTriangulo();
+	else
+		this->triangulacao = Triangulador::triangular(this->pontos);
+
+	this->triangulacaoPendente = false;
+}
+
 const String Poligono::toString() const {
 	String str = this->pontos.at(0).toString();
 
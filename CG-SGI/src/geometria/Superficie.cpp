@@ -21,3 +21,8 @@ void Superficie::aplicarTransformacao(const double matriz[4][4]) {
 	this->ObjetoGeometrico::aplicarTransformacao(matriz);
 	this->calcularPontosParametricos();
 }
+
+void Superficie::aplicarProjecao(const double matriz[4][4]) {
+	this->ObjetoGeometrico::aplicarProjecao(matriz);
+	this->calcularPontosParametricos();
+}
@@ -0,0 +1,457 @@
+#include "geometria/Triangulador.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "geometria/Faceta.h"
+
+/**
+ * Compara as arestas pela coordenada x em que cruzam a linha de varredura.
+ * A aresta -1 representa o vértice sendo processado.
+ */
+struct Triangulador::ComparadorArestas {
+	const QVector<Vertice>* vertices;
+	const Vertice* atual;
+
+	double x(const int aresta) const {
+		if (aresta < 0)
+			return this->atual->x;
+
+		const Vertice& a = this->vertices->at(aresta);
+		const Vertice& b = this->vertices->at(
+				(aresta + 1) % this->vertices->size());
+
+		if (a.y == b.y)
+			return std::min(a.x, b.x);
+
+		return a.x + (this->atual->y - a.y) * (b.x - a.x) / (b.y - a.y);
+	}
+
+	bool operator()(const int a, const int b) const {
+		if (a == b)
+			return false;
+
+		double xA = this->x(a);
+		double xB = this->x(b);
+
+		if (xA != xB)
+			return xA < xB;
+
+		// O vértice consultado fica depois das arestas que passam por ele
+		if (a < 0 || b < 0)
+			return b < 0;
+
+		return a < b;
+	}
+};
+
+QVector<int> Triangulador::triangular(const QList<Ponto>& pontos) {
+	QVector<int> triangulos;
+
+	if (pontos.size() < 3)
+		return triangulos;
+
+	if (pontos.size() == 3) {
+		triangulos.append(0);
+		triangulos.append(1);
+		triangulos.append(2);
+		return triangulos;
+	}
+
+	// Projetar no plano coordenado em que o polígono tem maior área
+	Ponto normal = Faceta::calcularVetorNormal(pontos);
+	double aX = fabs(normal.getX());
+	double aY = fabs(normal.getY());
+	double aZ = fabs(normal.getZ());
+	QVector<Vertice> vertices;
+	vertices.reserve(pontos.size());
+
+	for (int i = 0; i < pontos.size(); i++) {
+		const Ponto& p = pontos.at(i);
+		Vertice v;
+
+		if (aZ >= aX && aZ >= aY) {
+			v.x = p.getX();
+			v.y = p.getY();
+		} else if (aX >= aY) {
+			v.x = p.getY();
+			v.y = p.getZ();
+		} else {
+			v.x = p.getZ();
+			v.y = p.getX();
+		}
+
+		v.indice = i;
+
+		// Vértices repetidos (comuns após o clipping) não delimitam área
+		if (vertices.size() > 0 && vertices.last().x == v.x
+				&& vertices.last().y == v.y)
+			continue;
+
+		vertices.append(v);
+	}
+
+	while (vertices.size() > 1 && vertices.first().x == vertices.last().x
+			&& vertices.first().y == vertices.last().y)
+		vertices.removeLast();
+
+	double areaDupla = 0;
+
+	for (int i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++)
+		areaDupla += vertices.at(j).x * vertices.at(i).y
+				- vertices.at(i).x * vertices.at(j).y;
+
+	if (vertices.size() < 3 || areaDupla == 0 || areaDupla != areaDupla)
+		return triangulos;
+
+	// A varredura supõe o sentido anti-horário
+	bool invertido = areaDupla < 0;
+
+	if (invertido)
+		std::reverse(vertices.begin(), vertices.end());
+
+	QVector<int> locais;
+	QVector<QVector<int> > faces = Triangulador::extrairFaces(vertices,
+			Triangulador::particionarMonotono(vertices));
+
+	for (const QVector<int>& face : faces)
+		Triangulador::triangularMonotono(vertices, face, &locais);
+
+	// Entradas degeneradas (autointersecções) recaem em um leque
+	if (locais.size() != 3 * (vertices.size() - 2)) {
+		locais.clear();
+
+		for (int i = 1; i + 1 < vertices.size(); i++) {
+			locais.append(0);
+			locais.append(i);
+			locais.append(i + 1);
+		}
+	}
+
+	triangulos.reserve(locais.size());
+
+	for (int i = 0; i < locais.size(); i += 3) {
+		triangulos.append(vertices.at(locais.at(i)).indice);
+		triangulos.append(vertices.at(locais.at(invertido ? i + 2 : i + 1)).indice);
+		triangulos.append(vertices.at(locais.at(invertido ? i + 1 : i + 2)).indice);
+	}
+
+	return triangulos;
+}
+
+bool Triangulador::acima(const Vertice& a, const Vertice& b) {
+	return a.y > b.y || (a.y == b.y && a.x < b.x);
+}
+
+double Triangulador::orientacao(const Vertice& a, const Vertice& b,
+		const Vertice& c) {
+	return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+QVector<int> Triangulador::particionarMonotono(
+		const QVector<Vertice>& vertices) {
+	enum TipoVertice {
+		INICIO, FIM, DIVISAO, JUNCAO, REGULAR
+	};
+
+	int n = vertices.size();
+	std::vector<int> ordem(n);
+	std::vector<TipoVertice> tipos(n);
+
+	for (int i = 0; i < n; i++) {
+		const Vertice& anterior = vertices.at((i + n - 1) % n);
+		const Vertice& v = vertices.at(i);
+		const Vertice& proximo = vertices.at((i + 1) % n);
+		bool anteriorAbaixo = Triangulador::acima(v, anterior);
+		bool proximoAbaixo = Triangulador::acima(v, proximo);
+		bool convexo = Triangulador::orientacao(anterior, v, proximo) > 0;
+
+		if (anteriorAbaixo && proximoAbaixo)
+			tipos[i] = convexo ? INICIO : DIVISAO;
+		else if (!anteriorAbaixo && !proximoAbaixo)
+			tipos[i] = convexo ? FIM : JUNCAO;
+		else
+			tipos[i] = REGULAR;
+
+		ordem[i] = i;
+	}
+
+	std::sort(ordem.begin(), ordem.end(), [&vertices](int a, int b) {
+		return Triangulador::acima(vertices.at(a), vertices.at(b));
+	});
+
+	// Árvore das arestas à esquerda do interior que cruzam a varredura; a
+	// aresta i liga o vértice i ao vértice i + 1
+	Vertice atual = vertices.at(ordem[0]);
+	ComparadorArestas comparador;
+	comparador.vertices = &vertices;
+	comparador.atual = &atual;
+	typedef std::set<int, ComparadorArestas> Arvore;
+	Arvore arvore(comparador);
+	std::vector<Arvore::iterator> posicoes(n, arvore.end());
+	std::vector<int> ajudantes(n, -1);
+	QVector<int> diagonais;
+
+	auto adicionarDiagonal = [&](int a, int b) {
+		if (a >= 0 && b >= 0 && a != b) {
+			diagonais.append(a);
+			diagonais.append(b);
+		}
+	};
+	auto juncao = [&](int v) {
+		return v >= 0 && tipos[v] == JUNCAO;
+	};
+	auto inserir = [&](int aresta, int ajudante) {
+		posicoes[aresta] = arvore.insert(aresta).first;
+		ajudantes[aresta] = ajudante;
+	};
+	auto remover = [&](int aresta) {
+		if (posicoes[aresta] != arvore.end()) {
+			arvore.erase(posicoes[aresta]);
+			posicoes[aresta] = arvore.end();
+		}
+	};
+	auto arestaEsquerda = [&]() {
+		Arvore::iterator it = arvore.lower_bound(-1);
+		return it == arvore.begin() ? -1 : *(--it);
+	};
+
+	for (int v : ordem) {
+		atual = vertices.at(v);
+		int anterior = (v + n - 1) % n;
+		int esquerda;
+
+		switch (tipos[v]) {
+		case INICIO:
+			inserir(v, v);
+			break;
+		case FIM:
+			if (juncao(ajudantes[anterior]))
+				adicionarDiagonal(v, ajudantes[anterior]);
+			remover(anterior);
+			break;
+		case DIVISAO:
+			esquerda = arestaEsquerda();
+
+			if (esquerda >= 0) {
+				adicionarDiagonal(v, ajudantes[esquerda]);
+				ajudantes[esquerda] = v;
+			}
+
+			inserir(v, v);
+			break;
+		case JUNCAO:
+			if (juncao(ajudantes[anterior]))
+				adicionarDiagonal(v, ajudantes[anterior]);
+			remover(anterior);
+			esquerda = arestaEsquerda();
+
+			if (esquerda >= 0) {
+				if (juncao(ajudantes[esquerda]))
+					adicionarDiagonal(v, ajudantes[esquerda]);
+				ajudantes[esquerda] = v;
+			}
+			break;
+		case REGULAR:
+			// Fronteira descendo: o interior está à direita do vértice
+			if (Triangulador::acima(vertices.at(anterior), vertices.at(v))) {
+				if (juncao(ajudantes[anterior]))
+					adicionarDiagonal(v, ajudantes[anterior]);
+				remover(anterior);
+				inserir(v, v);
+			} else {
+				esquerda = arestaEsquerda();
+
+				if (esquerda >= 0) {
+					if (juncao(ajudantes[esquerda]))
+						adicionarDiagonal(v, ajudantes[esquerda]);
+					ajudantes[esquerda] = v;
+				}
+			}
+			break;
+		}
+	}
+
+	return diagonais;
+}
+
+QVector<QVector<int> > Triangulador::extrairFaces(
+		const QVector<Vertice>& vertices, const QVector<int>& diagonais) {
+	int n = vertices.size();
+	std::vector<std::vector<int> > vizinhos(n);
+
+	for (int i = 0; i < n; i++) {
+		vizinhos[i].push_back((i + 1) % n);
+		vizinhos[i].push_back((i + n - 1) % n);
+	}
+
+	for (int i = 0; i + 1 < diagonais.size(); i += 2) {
+		vizinhos[diagonais.at(i)].push_back(diagonais.at(i + 1));
+		vizinhos[diagonais.at(i + 1)].push_back(diagonais.at(i));
+	}
+
+	// Vizinhos em sentido anti-horário ao redor de cada vértice
+	std::map<std::pair<int, int>, int> posicoes;
+	std::vector<std::vector<bool> > visitadas(n);
+	int totalArestas = 0;
+
+	for (int i = 0; i < n; i++) {
+		const Vertice& v = vertices.at(i);
+		std::vector<int>& lista = vizinhos[i];
+		std::sort(lista.begin(), lista.end());
+		lista.erase(std::unique(lista.begin(), lista.end()), lista.end());
+		std::sort(lista.begin(), lista.end(), [&](int a, int b) {
+			return atan2(vertices.at(a).y - v.y, vertices.at(a).x - v.x)
+					< atan2(vertices.at(b).y - v.y, vertices.at(b).x - v.x);
+		});
+
+		for (unsigned int k = 0; k < lista.size(); k++)
+			posicoes[std::make_pair(i, lista[k])] = k;
+
+		visitadas[i].assign(lista.size(), false);
+		totalArestas += lista.size();
+	}
+
+	// As arestas do contorno percorridas no sentido horário delimitam o
+	// exterior do polígono
+	for (int i = 0; i < n; i++)
+		visitadas[i][posicoes[std::make_pair(i, (i + n - 1) % n)]] = true;
+
+	QVector<QVector<int> > faces;
+
+	for (int i = 0; i < n; i++) {
+		for (unsigned int k = 0; k < vizinhos[i].size(); k++) {
+			if (visitadas[i][k])
+				continue;
+
+			QVector<int> face;
+			int u = i;
+			int posicao = k;
+
+			while (!visitadas[u][posicao] && face.size() <= totalArestas) {
+				visitadas[u][posicao] = true;
+				face.append(u);
+
+				// Próxima aresta da face: o vizinho anterior a u em torno de w
+				int w = vizinhos[u][posicao];
+				int tamanho = vizinhos[w].size();
+				posicao = (posicoes[std::make_pair(w, u)] + tamanho - 1)
+						% tamanho;
+				u = w;
+			}
+
+			faces.append(face);
+		}
+	}
+
+	return faces;
+}
+
+void Triangulador::triangularMonotono(const QVector<Vertice>& vertices,
+		const QVector<int>& face, QVector<int>* triangulos) {
+	int m = face.size();
+
+	if (m < 3)
+		return;
+
+	auto emitir = [&](int a, int b, int c) {
+		const Vertice& vA = vertices.at(face.at(a));
+		const Vertice& vB = vertices.at(face.at(b));
+		const Vertice& vC = vertices.at(face.at(c));
+
+		if (Triangulador::orientacao(vA, vB, vC) < 0)
+			std::swap(b, c);
+
+		triangulos->append(face.at(a));
+		triangulos->append(face.at(b));
+		triangulos->append(face.at(c));
+	};
+
+	int topo = 0;
+	int base = 0;
+
+	for (int i = 1; i < m; i++) {
+		if (Triangulador::acima(vertices.at(face.at(i)),
+				vertices.at(face.at(topo))))
+			topo = i;
+		if (Triangulador::acima(vertices.at(face.at(base)),
+				vertices.at(face.at(i))))
+			base = i;
+	}
+
+	// No sentido anti-horário, a cadeia esquerda desce do topo até a base
+	std::vector<bool> esquerda(m, false);
+
+	for (int i = topo; i != base; i = (i + 1) % m)
+		esquerda[i] = true;
+
+	// Intercalar as duas cadeias de cima para baixo
+	std::vector<int> ordem;
+	ordem.reserve(m);
+	ordem.push_back(topo);
+	int l = (topo + 1) % m;
+	int r = (topo + m - 1) % m;
+
+	while (l != base || r != base) {
+		if (r == base || (l != base
+				&& Triangulador::acima(vertices.at(face.at(l)),
+						vertices.at(face.at(r))))) {
+			ordem.push_back(l);
+			l = (l + 1) % m;
+		} else {
+			ordem.push_back(r);
+			r = (r + m - 1) % m;
+		}
+	}
+
+	ordem.push_back(base);
+
+	std::vector<int> pilha;
+	pilha.push_back(ordem[0]);
+	pilha.push_back(ordem[1]);
+
+	for (int j = 2; j < m - 1; j++) {
+		int u = ordem[j];
+
+		if (esquerda[u] != esquerda[pilha.back()]) {
+			while (pilha.size() > 1) {
+				int a = pilha.back();
+				pilha.pop_back();
+				emitir(u, a, pilha.back());
+			}
+
+			pilha.clear();
+			pilha.push_back(ordem[j - 1]);
+			pilha.push_back(u);
+		} else {
+			int ultimo = pilha.back();
+			pilha.pop_back();
+
+			while (!pilha.empty()) {
+				double o = Triangulador::orientacao(
+						vertices.at(face.at(pilha.back())),
+						vertices.at(face.at(ultimo)), vertices.at(face.at(u)));
+
+				if (esquerda[u] ? o <= 0 : o >= 0)
+					break;
+
+				emitir(u, ultimo, pilha.back());
+				ultimo = pilha.back();
+				pilha.pop_back();
+			}
+
+			pilha.push_back(ultimo);
+			pilha.push_back(u);
+		}
+	}
+
+	int u = ordem[m - 1];
+
+	while (pilha.size() > 1) {
+		int a = pilha.back();
+		pilha.pop_back();
+		emitir(u, a, pilha.back());
+	}
+}
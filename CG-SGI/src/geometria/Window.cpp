@@ -1,4 +1,5 @@
 #include "geometria/Window.h"
+#include "util/Desempenho.h"
 
 Window::Window() : ObjetoGeometrico("Window", Tipo::WINDOW) {
 	this->centro = Ponto("centro", 0, 0, 0);
@@ -7,6 +8,7 @@ Window::Window() : ObjetoGeometrico("Window", Tipo::WINDOW) {
 	this->viewRightVector = Ponto("viewRightVector", 0, 118.75, 0);
 	this->vpnVector = Ponto("vpnVector", 0, 0, 120);
 	this->projetor = 0;
+	this->revisaoCamera = 0;
 	this->setTipoProjecao(Projetor::PERSPECTIVA);
 }
 
@@ -16,9 +18,10 @@ Window::Window(const Window& window) : ObjetoGeometrico(window) {
 	this->viewUpVector = window.viewUpVector;
 	this->viewRightVector = window.viewRightVector;
 	this->vpnVector = window.vpnVector;
-	this->displayFileNormalizado = window.displayFileNormalizado;
 	this->projetor = 0;
+	this->revisaoCamera = 0;
 	this->setTipoProjecao(window.projetor->getTipo());
+	this->revisao = window.revisao;
 }
 
 Window::Window(const Ponto& centro, const double largura, const double altura) : ObjetoGeometrico("Window", Tipo::WINDOW) {
@@ -28,12 +31,15 @@ Window::Window(const Ponto& centro, const double largura, const double altura) :
 	this->viewRightVector = Ponto("viewRightVector", 0, largura/2, 0);
 	this->vpnVector = Ponto("viewRightVector", 0, 0, 120);
 	this->projetor = 0;
+	this->revisaoCamera = 0;
 	this->setTipoProjecao(Projetor::PERSPECTIVA);
 }
 
 Window::~Window() {
 	if(this->projetor)
 		delete this->projetor;
+
+	this->displayFileNormalizado.removerObjetos();
 }
 
 Window& Window::operator=(const Window& window) {
@@ -43,9 +49,9 @@ Window& Window::operator=(const Window& window) {
 	this->viewUpVector = window.viewUpVector;
 	this->viewRightVector = window.viewRightVector;
 	this->vpnVector = window.vpnVector;
-	this->displayFileNormalizado = window.displayFileNormalizado;
-	this->projetor = 0;
 	this->setTipoProjecao(window.projetor->getTipo());
+	this->revisao = window.revisao;
+	this->revisaoCamera = 0;
 	return *this;
 }
 
@@ -92,33 +98,102 @@ Ponto Window::getCentroProjecao() const {
 }
 
 void Window::atualizarDisplayFile(const DisplayFile& displayFile) {
-	this->displayFileNormalizado = displayFile;
-	int tam = this->displayFileNormalizado.getTamanho();
+	Desempenho::Cronometro cronometro(Desempenho::PROJECAO);
+	QList<ObjetoGeometrico*> objetos = displayFile.getObjetos();
+
+	for(ObjetoGeometrico* obj : objetos)
+		this->atualizarObjeto(obj);
 
-	for(int i = 0; i < tam; i++)
-		this->atualizarObjeto(this->displayFileNormalizado.getObjeto(i));
+	// Todos os objetos do mundo estão normalizados: um tamanho maior indica
+	// objetos removidos do mundo sem passar pela window
+	if(this->displayFileNormalizado.getTamanho() == (unsigned int) objetos.size())
+		return;
+
+	for(const String& nome : this->revisoesNormalizadas.keys())
+		if(!displayFile.contem(nome))
+			this->removerObjeto(nome);
 }
 
 void Window::atualizarObjeto(ObjetoGeometrico* const obj) {
+	const String& nome = obj->getNome();
+	ObjetoGeometrico* objeto = this->displayFileNormalizado.getObjeto(nome);
+	Revisoes& revisoes = this->revisoesNormalizadas[nome];
+
+	if(objeto && revisoes.objeto == obj->getRevisao()
+			&& revisoes.window == this->revisao)
+		return;
+
+	if(!objeto || !this->restaurarObjeto(objeto, obj)) {
+		this->displayFileNormalizado.inserirObjeto(*obj);
+		objeto = this->displayFileNormalizado.getObjeto(nome);
+	}
+
+	this->atualizarCamera();
+	this->camera.projetarObjeto(objeto);
+	revisoes.objeto = obj->getRevisao();
+	revisoes.window = this->revisao;
+}
+
+void Window::atualizarCamera() {
+	if(this->revisaoCamera == this->revisao)
+		return;
+
 	double angulo = this->anguloViewUpVectorEixoY();
 	double tamY = this->getTamanhoViewUpVector();
 	double tamX = this->getTamanhoViewRightVector();
-	double matriz[4][4] = {{cos(-angulo)/tamX, -sin(-angulo)/tamY, 0, 0},
+	double normalizacao[4][4] = {{cos(-angulo)/tamX, -sin(-angulo)/tamY, 0, 0},
 							{sin(-angulo)/tamX, cos(-angulo)/tamY, 0, 0},
 							{0, 0, 1, 0},
 							{0, 0, 0, 1}};
+	double projecao[4][4];
 
-	if(!this->displayFileNormalizado.contem(obj->getNome())) {
-		this->displayFileNormalizado.inserirObjeto(*obj);
-	}
-
-	ObjetoGeometrico* objeto = this->displayFileNormalizado.getObjeto(obj->getNome());
-	this->projetor->projetarObjeto(objeto);
-	objeto->aplicarTransformacao(matriz);
+	this->projetor->montarMatriz(projecao);
+	this->camera.montar(projecao, normalizacao);
+	this->revisaoCamera = this->revisao;
 }
 
 void Window::removerObjeto(const String& nome) {
 	this->displayFileNormalizado.removerObjeto(nome);
+	this->revisoesNormalizadas.remove(nome);
+}
+
+bool Window::restaurarObjeto(ObjetoGeometrico* const normalizado,
+		ObjetoGeometrico* const obj) const {
+	// O objeto 3D passa a compartilhar a malha do objeto do mundo; a projeção
+	// copia somente as posições e normais, mantendo a topologia compartilhada
+	if(obj->getTipo() == Tipo::OBJETO3D
+			&& normalizado->getTipo() == Tipo::OBJETO3D) {
+		*((Objeto3D*) normalizado) = *((const Objeto3D*) obj);
+		return true;
+	}
+
+	// O polígono leva também a triangulação, que pode ter mudado com os
+	// pontos do objeto do mundo
+	if(obj->getTipo() == Tipo::POLIGONO
+			&& normalizado->getTipo() == Tipo::POLIGONO) {
+		*((Poligono*) normalizado) = *((const Poligono*) obj);
+		return true;
+	}
+
+	if(normalizado->getTipo() != obj->getTipo()
+			|| obj->getTipo() == Tipo::OBJETO3D)
+		return false;
+
+	QList<Ponto*> destino = normalizado->getPontosObjeto();
+	QList<Ponto*> origem = obj->getPontosObjeto();
+
+	if(destino.size() != origem.size())
+		return false;
+
+	for(int i = 0; i < origem.size(); i++) {
+		destino.at(i)->setX(origem.at(i)->getX());
+		destino.at(i)->setY(origem.at(i)->getY());
+		destino.at(i)->setZ(origem.at(i)->getZ());
+	}
+
+	normalizado->setCor(obj->getCor());
+
+	return true;
 }
 
 double Window::anguloViewUpVectorEixoY() const {
@@ -158,6 +233,7 @@ QList<ObjetoGeometrico*> Window::getObjetos() const {
 
 void Window::removerObjetos() {
 	this->displayFileNormalizado.removerObjetos();
+	this->revisoesNormalizadas.clear();
 }
 
 void Window::setTipoProjecao(const Projetor::TipoProjecao& tipoProjecao) {
@@ -172,6 +248,8 @@ void Window::setTipoProjecao(const Projetor::TipoProjecao& tipoProjecao) {
 			this->projetor = new ProjetorPerspectiva(this);
 			break;
 	}
+
+	this->marcarAlteracao();
 }
 
 QList<Ponto*> Window::getPontosObjeto() {
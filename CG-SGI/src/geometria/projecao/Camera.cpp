@@ -0,0 +1,26 @@
+#include "geometria/projecao/Camera.h"
+#include "geometria/ObjetoGeometrico.h"
+
+Camera::Camera() {
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			this->matriz[i][j] = i == j ? 1 : 0;
+}
+
+Camera::~Camera() {
+}
+
+void Camera::montar(const double projecao[4][4],
+		const double normalizacao[4][4]) {
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++) {
+			this->matriz[i][j] = 0;
+
+			for (int k = 0; k < 4; k++)
+				this->matriz[i][j] += projecao[i][k] * normalizacao[k][j];
+		}
+}
+
+void Camera::projetarObjeto(ObjetoGeometrico* const objeto) const {
+	objeto->aplicarProjecao(this->matriz);
+}
@@ -1,6 +1,8 @@
 #include "geometria/projecao/Projetor.h"
 #include "geometria/Window.h"
 
+#include <cmath>
+
 Projetor::Projetor(const TipoProjecao& tipo, Window* const window) {
 	this->tipo = tipo;
 	this->window = window;
@@ -11,3 +13,28 @@ Projetor::~Projetor() {}
 Projetor::TipoProjecao Projetor::getTipo() const {
 	return this->tipo;
 }
+
+void Projetor::montarMatrizVisualizacao(const Ponto& origem,
+		double matriz[4][4]) const {
+	Ponto vrp = this->window->getCentroGeometrico();
+	Ponto vpn = this->window->getVpnVector();
+	double x = origem.getX();
+	double y = origem.getY();
+	double z = origem.getZ();
+	double xC = vpn.getX() - vrp.getX();
+	double yC = vpn.getY() - vrp.getY();
+	double zC = vpn.getZ() - vrp.getZ();
+
+	double angX = atan(yC / sqrt(xC * xC + zC * zC));
+	double angY = atan(xC / sqrt(yC * yC + zC * zC));
+
+	double visualizacao[4][4] = { { cos(-angY), 0, sin(-angY), 0 },
+					{ sin(-angX)*sin(-angY), cos(-angX), -sin(-angX)*cos(-angY), 0 },
+					{ -cos(-angX)*sin(-angY), sin(-angX), cos(-angX)*cos(-angY), 0 },
+					{ -x*cos(-angY) - y*sin(-angX)*sin(-angY) + z*cos(-angX)*sin(-angY),
+						-y*cos(-angX) - z*sin(-angX), -x*sin(-angY) + y*sin(-angX)*cos(-angY) - z*cos(-angX)*cos(-angY), 1 } };
+
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			matriz[i][j] = visualizacao[i][j];
+}
@@ -1,5 +1,4 @@
 #include "geometria/projecao/ProjetorPerspectiva.h"
-#include "geometria/ObjetoGeometrico.h"
 #include "geometria/Window.h"
 
 ProjetorPerspectiva::ProjetorPerspectiva(Window* const window) :
@@ -9,46 +8,13 @@ ProjetorPerspectiva::ProjetorPerspectiva(Window* const window) :
 ProjetorPerspectiva::~ProjetorPerspectiva() {
 }
 
-void ProjetorPerspectiva::projetarObjeto(ObjetoGeometrico* const objeto) const {
-	Ponto vrp = this->window->getCentroGeometrico();
+void ProjetorPerspectiva::montarMatriz(double matriz[4][4]) const {
 	Ponto cop = this->window->getCentroProjecao();
-	Ponto vpn = this->window->getVpnVector();
-	double x = cop.getX();
-	double y = cop.getY();
-	double z = cop.getZ();
-	double xC = vpn.getX() - vrp.getX();
-	double yC = vpn.getY() - vrp.getY();
-	double zC = vpn.getZ() - vrp.getZ();
-	double d = -z;
+	double d = -cop.getZ();
 
-	double angX = atan(yC / sqrt(xC * xC + zC * zC));
-	double angY = atan(xC / sqrt(yC * yC + zC * zC));
+	// Com o centro de projeção na origem, x e y são multiplicados por d / z
+	this->montarMatrizVisualizacao(cop, matriz);
 
-//	if (xC > 0 && zC < 0) {
-//		angY += M_PI;
-//	} else if (xC < 0 && zC < 0) {
-//		angY += -M_PI;
-//	}
-//
-//	if (yC > 0 && zC < 0) {
-//		angX += M_PI;
-//	} else if (yC < 0 && zC < 0) {
-//		angX += -M_PI;
-//	}
-
-	double matriz[4][4] = { { cos(-angY), 0, sin(-angY), 0 },
-					{ sin(-angX)*sin(-angY), cos(-angX), -sin(-angX)*cos(-angY), 0 },
-					{ -cos(-angX)*sin(-angY), sin(-angX), cos(-angX)*cos(-angY), 0 },
-					{ -x*cos(-angY) - y*sin(-angX)*sin(-angY) + z*cos(-angX)*sin(-angY),
-						-y*cos(-angX) - z*sin(-angX), -x*sin(-angY) + y*sin(-angX)*cos(-angY) - z*cos(-angX)*cos(-angY), 1 } };
-
-	QList<Ponto*> pontosObj = objeto->getPontosObjeto();
-
-	for(Ponto* ponto : pontosObj) {
-		ponto->aplicarTransformacao(matriz);
-		double xp = d * ponto->getX() / ponto->getZ();
-		double yp = d * ponto->getY() / ponto->getZ();
-		ponto->setX(xp);
-		ponto->setY(yp);
-	}
+	for (int i = 0; i < 4; i++)
+		matriz[i][3] = matriz[i][2] / d;
 }
@@ -0,0 +1,371 @@
+#include "gui/FrameBuffer.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cfloat>
+#include <numeric>
+
+// Definições das constantes, que std::fill recebe por referência
+const unsigned int FrameBuffer::NENHUMA_FACETA;
+const int FrameBuffer::LADO_BLOCO;
+
+FrameBuffer::FrameBuffer(const unsigned int largura, const unsigned int altura,
+		const bool comNormais) {
+	unsigned int tamanho = largura * altura;
+	this->largura = largura;
+	this->altura = altura;
+	this->blocosX = (largura + LADO_BLOCO - 1) / LADO_BLOCO;
+	this->blocosY = (altura + LADO_BLOCO - 1) / LADO_BLOCO;
+	this->profundidade = new float[tamanho];
+	this->profundidadeMinimaBlocos = new float[this->blocosX * this->blocosY];
+	this->profundidadeMaximaBlocos = new float[this->blocosX * this->blocosY];
+	this->fragmentosTestadosBlocos =
+			new unsigned int[this->blocosX * this->blocosY];
+	this->fragmentosEscritosBlocos =
+			new unsigned int[this->blocosX * this->blocosY];
+	this->facetas = new unsigned int[tamanho];
+	this->normalX = 0;
+	this->normalY = 0;
+	this->normalZ = 0;
+
+	if (comNormais) {
+		this->normalX = new signed char[tamanho];
+		this->normalY = new signed char[tamanho];
+		this->normalZ = new signed char[tamanho];
+	}
+
+	this->limpar();
+}
+
+FrameBuffer::~FrameBuffer() {
+	delete[] this->profundidade;
+	delete[] this->profundidadeMinimaBlocos;
+	delete[] this->profundidadeMaximaBlocos;
+	delete[] this->fragmentosTestadosBlocos;
+	delete[] this->fragmentosEscritosBlocos;
+	delete[] this->facetas;
+
+	if (this->normalX) {
+		delete[] this->normalX;
+		delete[] this->normalY;
+		delete[] this->normalZ;
+	}
+}
+
+void FrameBuffer::limpar() {
+	unsigned int tamanho = this->largura * this->altura;
+	unsigned int blocos = this->blocosX * this->blocosY;
+	std::fill(this->profundidade, this->profundidade + tamanho, FLT_MAX);
+	std::fill(this->profundidadeMinimaBlocos,
+			this->profundidadeMinimaBlocos + blocos, FLT_MAX);
+	std::fill(this->profundidadeMaximaBlocos,
+			this->profundidadeMaximaBlocos + blocos, FLT_MAX);
+	std::fill(this->fragmentosTestadosBlocos,
+			this->fragmentosTestadosBlocos + blocos, 0);
+	std::fill(this->fragmentosEscritosBlocos,
+			this->fragmentosEscritosBlocos + blocos, 0);
+	std::fill(this->facetas, this->facetas + tamanho, NENHUMA_FACETA);
+
+	if (this->normalX) {
+		std::fill(this->normalX, this->normalX + tamanho, 0);
+		std::fill(this->normalY, this->normalY + tamanho, 0);
+		std::fill(this->normalZ, this->normalZ + tamanho, -127);
+	}
+}
+
+void FrameBuffer::limpar(const QRect& area) {
+	for (int y = area.top(); y <= area.bottom(); y++) {
+		unsigned int inicio = y * this->largura + area.left();
+		unsigned int fim = inicio + area.width();
+		std::fill(this->profundidade + inicio, this->profundidade + fim,
+				FLT_MAX);
+		std::fill(this->facetas + inicio, this->facetas + fim, NENHUMA_FACETA);
+
+		if (this->normalX) {
+			std::fill(this->normalX + inicio, this->normalX + fim, 0);
+			std::fill(this->normalY + inicio, this->normalY + fim, 0);
+			std::fill(this->normalZ + inicio, this->normalZ + fim, -127);
+		}
+	}
+
+	// Blocos inteiramente contidos na área voltam a ser vazios
+	int bxInicio = (area.left() + LADO_BLOCO - 1) / LADO_BLOCO;
+	int byInicio = (area.top() + LADO_BLOCO - 1) / LADO_BLOCO;
+	int bxFim = (area.right() + 1) / LADO_BLOCO;
+	int byFim = (area.bottom() + 1) / LADO_BLOCO;
+
+	if (area.right() + 1 >= (int) this->largura)
+		bxFim = this->blocosX;
+
+	if (area.bottom() + 1 >= (int) this->altura)
+		byFim = this->blocosY;
+
+	for (int by = byInicio; by < byFim; by++) {
+		unsigned int inicio = by * this->blocosX;
+		std::fill(this->profundidadeMinimaBlocos + inicio + bxInicio,
+				this->profundidadeMinimaBlocos + inicio + bxFim, FLT_MAX);
+		std::fill(this->profundidadeMaximaBlocos + inicio + bxInicio,
+				this->profundidadeMaximaBlocos + inicio + bxFim, FLT_MAX);
+		std::fill(this->fragmentosTestadosBlocos + inicio + bxInicio,
+				this->fragmentosTestadosBlocos + inicio + bxFim, 0);
+		std::fill(this->fragmentosEscritosBlocos + inicio + bxInicio,
+				this->fragmentosEscritosBlocos + inicio + bxFim, 0);
+	}
+}
+
+bool FrameBuffer::escreverFragmento(const int x, const int y, const float z,
+		const unsigned int faceta, const float nX, const float nY,
+		const float nZ) {
+	if (x < 0 || y < 0 || (unsigned int) x >= this->largura
+			|| (unsigned int) y >= this->altura)
+		return false;
+
+	unsigned int i = y * this->largura + x;
+	bool escrito = z < this->profundidade[i];
+	this->contarFragmentos(x, y, 1, escrito ? 1 : 0);
+
+	if (!escrito)
+		return false;
+
+	this->profundidade[i] = z;
+	this->facetas[i] = faceta;
+
+	if (this->normalX) {
+		this->normalX[i] = compactarNormal(nX);
+		this->normalY[i] = compactarNormal(nY);
+		this->normalZ[i] = compactarNormal(nZ);
+	}
+
+	return true;
+}
+
+void FrameBuffer::escreverSpan(const int y, const int xInicial,
+		const int xFinal, const double z, const double incrementoZ,
+		const unsigned int faceta, const float nX, const float nY,
+		const float nZ) {
+	if (y < 0 || (unsigned int) y >= this->altura)
+		return;
+
+	int inicio = xInicial < 0 ? 0 : xInicial;
+	int fim = xFinal >= (int) this->largura ? this->largura - 1 : xFinal;
+	float zInicio = (float) (z + (inicio - xInicial) * incrementoZ);
+	float dz = (float) incrementoZ;
+	signed char nXc = compactarNormal(nX);
+	signed char nYc = compactarNormal(nY);
+	signed char nZc = compactarNormal(nZ);
+	const int grupo = KernelsFragmentos::LARGURA_GRUPO;
+
+	for (int x = inicio; x <= fim; x += grupo) {
+		int n = fim - x + 1 < grupo ? fim - x + 1 : grupo;
+		unsigned int i = y * this->largura + x;
+
+		int escritos = KernelsFragmentos::escreverFragmentos(
+				this->profundidade + i, this->facetas + i,
+				this->normalX ? this->normalX + i : 0,
+				this->normalY ? this->normalY + i : 0,
+				this->normalZ ? this->normalZ + i : 0, n, (1u << n) - 1,
+				zInicio, dz, x - inicio, faceta, nXc, nYc, nZc);
+		this->contarFragmentos(x, y, n, escritos);
+	}
+}
+
+void FrameBuffer::escreverMascara(const int y, const int x,
+		const unsigned int mascara, const double z, const double incrementoZ,
+		const unsigned int faceta, const float nX, const float nY,
+		const float nZ) {
+	if (y < 0 || (unsigned int) y >= this->altura)
+		return;
+
+	// Descartar as colunas fora do buffer
+	int inicio = x;
+	unsigned int cobertos = mascara;
+
+	if (inicio < 0) {
+		cobertos = -inicio < 32 ? cobertos >> -inicio : 0;
+		inicio = 0;
+	}
+
+	int n = (int) this->largura - inicio;
+
+	if (n > KernelsFragmentos::LARGURA_GRUPO)
+		n = KernelsFragmentos::LARGURA_GRUPO;
+
+	if (n <= 0)
+		return;
+
+	cobertos &= (1u << n) - 1;
+
+	if (!cobertos)
+		return;
+
+	unsigned int i = y * this->largura + inicio;
+
+	int escritos = KernelsFragmentos::escreverFragmentos(
+			this->profundidade + i, this->facetas + i,
+			this->normalX ? this->normalX + i : 0,
+			this->normalY ? this->normalY + i : 0,
+			this->normalZ ? this->normalZ + i : 0, n, cobertos,
+			(float) (z + (inicio - x) * incrementoZ), (float) incrementoZ, 0,
+			faceta, compactarNormal(nX), compactarNormal(nY),
+			compactarNormal(nZ));
+	this->contarFragmentos(inicio, y, std::bitset<32>(cobertos).count(),
+			escritos);
+}
+
+bool FrameBuffer::coberto(const unsigned int x, const unsigned int y) const {
+	return this->profundidade[y * this->largura + x] < FLT_MAX;
+}
+
+float FrameBuffer::getProfundidade(const unsigned int x,
+		const unsigned int y) const {
+	return this->profundidade[y * this->largura + x];
+}
+
+unsigned int FrameBuffer::getFaceta(const unsigned int x,
+		const unsigned int y) const {
+	return this->facetas[y * this->largura + x];
+}
+
+void FrameBuffer::getNormal(const unsigned int x, const unsigned int y,
+		float* nX, float* nY, float* nZ) const {
+	if (!this->normalX) {
+		*nX = 0;
+		*nY = 0;
+		*nZ = -1;
+		return;
+	}
+
+	unsigned int i = y * this->largura + x;
+	*nX = this->normalX[i] / 127.0f;
+	*nY = this->normalY[i] / 127.0f;
+	*nZ = this->normalZ[i] / 127.0f;
+}
+
+void FrameBuffer::atualizarHierarquia(const QRect& area) {
+	int xInicio = std::max(area.left(), 0);
+	int yInicio = std::max(area.top(), 0);
+	int xFim = std::min(area.right(), (int) this->largura - 1);
+	int yFim = std::min(area.bottom(), (int) this->altura - 1);
+
+	if (xInicio > xFim || yInicio > yFim)
+		return;
+
+	for (int by = yInicio / LADO_BLOCO; by <= yFim / LADO_BLOCO; by++) {
+		for (int bx = xInicio / LADO_BLOCO; bx <= xFim / LADO_BLOCO; bx++) {
+			int x0 = bx * LADO_BLOCO;
+			int x1 = std::min(x0 + LADO_BLOCO, (int) this->largura);
+			int y0 = by * LADO_BLOCO;
+			int y1 = std::min(y0 + LADO_BLOCO, (int) this->altura);
+			float zMinimo = FLT_MAX;
+			float zMaximo = -FLT_MAX;
+
+			for (int y = y0; y < y1; y++) {
+				const float* linha = this->profundidade + y * this->largura;
+
+				for (int x = x0; x < x1; x++) {
+					zMinimo = std::min(zMinimo, linha[x]);
+					zMaximo = std::max(zMaximo, linha[x]);
+				}
+			}
+
+			this->profundidadeMinimaBlocos[by * this->blocosX + bx] = zMinimo;
+			this->profundidadeMaximaBlocos[by * this->blocosX + bx] = zMaximo;
+		}
+	}
+}
+
+float FrameBuffer::getProfundidadeMinima(const QRect& area) const {
+	int xInicio = std::max(area.left(), 0);
+	int yInicio = std::max(area.top(), 0);
+	int xFim = std::min(area.right(), (int) this->largura - 1);
+	int yFim = std::min(area.bottom(), (int) this->altura - 1);
+	float zMinimo = FLT_MAX;
+
+	if (xInicio > xFim || yInicio > yFim)
+		return zMinimo;
+
+	for (int by = yInicio / LADO_BLOCO; by <= yFim / LADO_BLOCO; by++)
+		for (int bx = xInicio / LADO_BLOCO; bx <= xFim / LADO_BLOCO; bx++)
+			zMinimo = std::min(zMinimo,
+					this->profundidadeMinimaBlocos[by * this->blocosX + bx]);
+
+	return zMinimo;
+}
+
+float FrameBuffer::getProfundidadeMaxima(const QRect& area) const {
+	int xInicio = std::max(area.left(), 0);
+	int yInicio = std::max(area.top(), 0);
+	int xFim = std::min(area.right(), (int) this->largura - 1);
+	int yFim = std::min(area.bottom(), (int) this->altura - 1);
+	float zMaximo = -FLT_MAX;
+
+	// Região fora do buffer: nada pode ser considerado oculto
+	if (xInicio > xFim || yInicio > yFim)
+		return FLT_MAX;
+
+	for (int by = yInicio / LADO_BLOCO; by <= yFim / LADO_BLOCO; by++)
+		for (int bx = xInicio / LADO_BLOCO; bx <= xFim / LADO_BLOCO; bx++)
+			zMaximo = std::max(zMaximo,
+					this->profundidadeMaximaBlocos[by * this->blocosX + bx]);
+
+	return zMaximo;
+}
+
+unsigned long FrameBuffer::getNumFragmentosTestados() const {
+	return std::accumulate(this->fragmentosTestadosBlocos,
+			this->fragmentosTestadosBlocos + this->blocosX * this->blocosY,
+			0ul);
+}
+
+unsigned long FrameBuffer::getNumFragmentosEscritos() const {
+	return std::accumulate(this->fragmentosEscritosBlocos,
+			this->fragmentosEscritosBlocos + this->blocosX * this->blocosY,
+			0ul);
+}
+
+float* FrameBuffer::getPlanoProfundidade() {
+	return this->profundidade;
+}
+
+unsigned int* FrameBuffer::getPlanoFacetas() {
+	return this->facetas;
+}
+
+void FrameBuffer::getPlanosNormais(signed char** nX, signed char** nY,
+		signed char** nZ) {
+	*nX = this->normalX;
+	*nY = this->normalY;
+	*nZ = this->normalZ;
+}
+
+bool FrameBuffer::temNormais() const {
+	return this->normalX != 0;
+}
+
+unsigned int FrameBuffer::getLargura() const {
+	return this->largura;
+}
+
+unsigned int FrameBuffer::getAltura() const {
+	return this->altura;
+}
+
+signed char FrameBuffer::compactarNormal(const float n) {
+	float v = n * 127.0f;
+
+	if (v > 127.0f)
+		v = 127.0f;
+	else if (v < -127.0f)
+		v = -127.0f;
+
+	return (signed char) (v < 0 ? v - 0.5f : v + 0.5f);
+}
+
+void FrameBuffer::contarFragmentos(const int x, const int y,
+		const unsigned int testados, const unsigned int escritos) {
+	// Grupos de uma escrita nunca cruzam tiles; o bloco do primeiro pixel
+	// pertence ao mesmo tile que os demais
+	unsigned int bloco = (y / LADO_BLOCO) * this->blocosX + x / LADO_BLOCO;
+	this->fragmentosTestadosBlocos[bloco] += testados;
+	this->fragmentosEscritosBlocos[bloco] += escritos;
+}
@@ -1,7 +1,14 @@
 #include "gui/Iluminador.h"
 
-#include <iostream>
-using namespace std;
+#include <cmath>
+#include <cstring>
+
+#include "gui/KernelsFragmentos.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define ILUMINACAO_X86
+#include <immintrin.h>
+#endif
 
 Iluminador::Iluminador(const unsigned int tamX, const unsigned int tamY) {
 	this->tamX = tamX;
@@ -12,120 +19,383 @@ Iluminador::Iluminador(const unsigned int tamX, const unsigned int tamY) {
 Iluminador::~Iluminador() {
 }
 
-Pixel Iluminador::iluminarPixel(Pixel p) {
-	QColor corDif = this->calcularComponenteDifusa(p);
-	QColor corEsp = this->calcularComponenteEspecular(p);
-	QColor corAmb = this->calcularComponenteAmbiente(p);
-	int rDif;
-	int gDif;
-	int bDif;
-	int rEsp;
-	int gEsp;
-	int bEsp;
-	int rAmb;
-	int gAmb;
-	int bAmb;
-	int a;
-	corDif.getRgb(&rDif, &gDif, &bDif, &a);
-	corEsp.getRgb(&rEsp, &gEsp, &bEsp, &a);
-	corAmb.getRgb(&rAmb, &gAmb, &bAmb, &a);
-	int iR = rDif + rEsp + rAmb;
-	if (iR > 255) {
-		iR = 255;
-	}
-	int iG = gDif + gEsp + gAmb;
-	if (iG > 255) {
-		iG = 255;
-	}
-	int iB = bDif + bEsp + bAmb;
-	if (iB > 255) {
-		iB = 255;
-	}
-	p.setCor(QColor(iR, iG, iB));
-	return p;
-}
-
-QColor Iluminador::calcularComponenteDifusa(Pixel p) {
+Pixel Iluminador::iluminarPixel(Pixel p) const {
 	Ponto normal = p.getNormal();
-	double xN = this->fonteDeLuz.getX() - p.getX();
-	double yN = this->fonteDeLuz.getY() - p.getY();
-	double zN = this->fonteDeLuz.getZ() - p.getZ();
-	double comprimento = sqrt(xN * xN + yN * yN + zN * zN);
-	Ponto vN("", xN / comprimento, yN / comprimento, zN / comprimento); //vetor normalizado apontando para a fonte de luz
-	double multVetores = normal.getX() * vN.getX() + normal.getY() * vN.getY()
-			+ normal.getZ() * vN.getZ();
-	if(multVetores<0)
-		multVetores = 0;
-	QColor cor = p.getCor();
-	int r;
-	int g;
-	int b;
-	int a;
-	cor.getRgb(&r, &g, &b, &a);
-	double kD = 0.9; //coeficiente de reflectividade difusa
-	int rDif = (int) (kD * r * multVetores);
-	int gDif = (int) (kD * g * multVetores);
-	int bDif = (int) (kD * b * multVetores);
-	//cout << "r" << rDif << endl;
-	//cout << "g" << gDif << endl;
-	//cout << "b" << bDif << endl;
-	return QColor(rDif, gDif, bDif);
+	QRgb cor = this->iluminar(p.getX(), p.getY(), p.getZ(), p.getCor().rgb(),
+			normal.getX(), normal.getY(), normal.getZ());
+	p.setCor(QColor(qRed(cor), qGreen(cor), qBlue(cor)));
+	return p;
 }
 
-QColor Iluminador::calcularComponenteEspecular(Pixel p) {
-	//calcular vetor raio refletido
-	double xL = this->fonteDeLuz.getX() - p.getX();
-	double yL = this->fonteDeLuz.getY() - p.getY();
-	double zL = this->fonteDeLuz.getZ() - p.getZ();
+QRgb Iluminador::iluminar(const unsigned int x, const unsigned int y,
+		const double z, const QRgb cor, const double nX, const double nY,
+		const double nZ) const {
+	// Vetor normalizado apontando para a fonte de luz
+	double xL = this->fonteDeLuz.getX() - x;
+	double yL = this->fonteDeLuz.getY() - y;
+	double zL = this->fonteDeLuz.getZ() - z;
 	double comprimento = sqrt(xL * xL + yL * yL + zL * zL);
-	Ponto vLuz("", xL / comprimento, yL / comprimento, zL / comprimento);
-	Ponto normal = p.getNormal();
-	double mult = 2
-			* (vLuz.getX() * normal.getX() + vLuz.getY() * normal.getY()
-					+ vLuz.getZ() * normal.getZ());
-	double xR = mult * normal.getX() - vLuz.getX();
-	double yR = mult * normal.getY() - vLuz.getY();
-	double zR = mult * normal.getZ() - vLuz.getZ();
-	Ponto vRef("", xR, yR, zR);
-	//calcular vetor observador
-	double xO = p.getX() - this->tamX;
-	double yO = p.getY() - this->tamY;
-	double zO = p.getZ() + 15;
+	xL /= comprimento;
+	yL /= comprimento;
+	zL /= comprimento;
+
+	// Componente difusa
+	double nDotL = nX * xL + nY * yL + nZ * zL;
+	double difusa = nDotL < 0 ? 0 : nDotL;
+
+	// Componente especular: raio refletido em relação ao observador
+	double mult = 2 * nDotL;
+	double xR = mult * nX - xL;
+	double yR = mult * nY - yL;
+	double zR = mult * nZ - zL;
+	double xO = x - this->tamX;
+	double yO = y - this->tamY;
+	double zO = z + 15;
 	comprimento = sqrt(xO * xO + yO * yO + zO * zO);
-	Ponto vObs("", xO / comprimento, yO / comprimento, zO / comprimento);
-	double multVetores = vRef.getX() * vObs.getX() + vRef.getY() * vObs.getY()
-			+ vRef.getZ() * vObs.getZ();
-	double s = 10; //expoente especular
-	multVetores = pow(multVetores, s);
-	double kE = 0.5; //coeficiente de reflectividade especular
-	int rEsp = (int) (kE * 255 * multVetores);
-	int gEsp = (int) (kE * 255 * multVetores);
-	int bEsp = (int) (kE * 255 * multVetores);
-	//cout << "r" << rEsp << endl;
-	//cout << "g" << gEsp << endl;
-	//cout << "b" << bEsp << endl;
-	if (rEsp > 255) {
-		rEsp = 255;
+	double rDotO = xR * (xO / comprimento) + yR * (yO / comprimento)
+			+ zR * (zO / comprimento);
+
+	// Expoente especular 10, por multiplicações
+	double rDotO2 = rDotO * rDotO;
+	double rDotO4 = rDotO2 * rDotO2;
+	int especular = (int) (K_ESPECULAR * 255 * (rDotO4 * rDotO4 * rDotO2));
+
+	if (especular > 255)
+		especular = 255;
+
+	int canais[3] = { qRed(cor), qGreen(cor), qBlue(cor) };
+
+	for (int i = 0; i < 3; i++) {
+		int c = (int) (K_DIFUSA * canais[i] * difusa) + especular
+				+ (int) (K_AMBIENTE * canais[i]);
+		canais[i] = c > 255 ? 255 : c;
 	}
-	if (gEsp > 255) {
-		gEsp = 255;
+
+	return qRgb(canais[0], canais[1], canais[2]);
+}
+
+/**
+ * Parâmetros de uma sequência de pixels iluminada em precisão simples.
+ */
+struct SequenciaIluminacao {
+	unsigned int x;
+	unsigned int tamX;
+	float luzX;
+	float luzZ;
+	float yLuz;
+	float yObservador;
+	float kDifusa;
+	float kEspecular;
+	float kAmbiente;
+	const float* profundidade;
+	const signed char* normalX;
+	const signed char* normalY;
+	const signed char* normalZ;
+	const QRgb* albedos;
+	QRgb* destino;
+};
+
+static void iluminarEscalar(const SequenciaIluminacao& s, const int inicio,
+		const int fim) {
+	for (int k = inicio; k < fim; k++) {
+		unsigned int x = s.x + k;
+		float z = s.profundidade[k];
+
+		float xL = s.luzX - (float) x;
+		float yL = s.yLuz;
+		float zL = s.luzZ - z;
+		float comprimento = sqrtf(xL * xL + yL * yL + zL * zL);
+		xL = xL / comprimento;
+		yL = yL / comprimento;
+		zL = zL / comprimento;
+
+		float nX = (float) s.normalX[k] / 127.0f;
+		float nY = (float) s.normalY[k] / 127.0f;
+		float nZ = (float) s.normalZ[k] / 127.0f;
+		float nDotL = nX * xL + nY * yL + nZ * zL;
+		float difusa = nDotL > 0 ? nDotL : 0;
+
+		float mult = 2 * nDotL;
+		float xR = mult * nX - xL;
+		float yR = mult * nY - yL;
+		float zR = mult * nZ - zL;
+		float xO = (float) (x - s.tamX);
+		float yO = s.yObservador;
+		float zO = z + 15;
+		comprimento = sqrtf(xO * xO + yO * yO + zO * zO);
+		float rDotO = xR * (xO / comprimento) + yR * (yO / comprimento)
+				+ zR * (zO / comprimento);
+		float rDotO2 = rDotO * rDotO;
+		float rDotO4 = rDotO2 * rDotO2;
+		int especular = (int) (s.kEspecular * (rDotO4 * rDotO4 * rDotO2));
+
+		if (especular > 255)
+			especular = 255;
+
+		QRgb albedo = s.albedos[k];
+		int canais[3] = { qRed(albedo), qGreen(albedo), qBlue(albedo) };
+
+		for (int i = 0; i < 3; i++) {
+			float c = (float) canais[i];
+			int v = (int) (s.kDifusa * c * difusa) + especular
+					+ (int) (s.kAmbiente * c);
+			canais[i] = v > 255 ? 255 : v;
+		}
+
+		s.destino[k] = qRgb(canais[0], canais[1], canais[2]);
 	}
-	if (bEsp > 255) {
-		bEsp = 255;
+}
+
+#ifdef ILUMINACAO_X86
+
+/**
+ * Converter inteiros sem sinal para float com um único arredondamento.
+ */
+__attribute__((target("sse2")))
+static inline __m128 converterSemSinalSse2(const __m128i v) {
+	__m128 alto = _mm_cvtepi32_ps(_mm_srli_epi32(v, 16));
+	__m128 baixo = _mm_cvtepi32_ps(_mm_and_si128(v, _mm_set1_epi32(0xFFFF)));
+	return _mm_add_ps(_mm_mul_ps(alto, _mm_set1_ps(65536.0f)), baixo);
+}
+
+/**
+ * Carregar 4 componentes de normal compactadas, estendendo o sinal.
+ */
+__attribute__((target("sse2")))
+static inline __m128 carregarNormalSse2(const signed char* const normal) {
+	int bytes;
+	memcpy(&bytes, normal, sizeof(bytes));
+	__m128i v = _mm_cvtsi32_si128(bytes);
+	v = _mm_unpacklo_epi8(v, v);
+	v = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 24);
+	return _mm_div_ps(_mm_cvtepi32_ps(v), _mm_set1_ps(127.0f));
+}
+
+__attribute__((target("sse2")))
+static void iluminarSse2(const SequenciaIluminacao& s, const int n) {
+	const __m128 zero = _mm_setzero_ps();
+	const __m128i limite = _mm_set1_epi32(255);
+	const __m128i mascaraCanal = _mm_set1_epi32(0xFF);
+	int k = 0;
+
+	for (; k + 4 <= n; k += 4) {
+		__m128i x = _mm_add_epi32(_mm_set1_epi32(s.x + k),
+				_mm_set_epi32(3, 2, 1, 0));
+		__m128 z = _mm_loadu_ps(s.profundidade + k);
+
+		__m128 xL = _mm_sub_ps(_mm_set1_ps(s.luzX), _mm_cvtepi32_ps(x));
+		__m128 yL = _mm_set1_ps(s.yLuz);
+		__m128 zL = _mm_sub_ps(_mm_set1_ps(s.luzZ), z);
+		__m128 comprimento = _mm_sqrt_ps(
+				_mm_add_ps(_mm_add_ps(_mm_mul_ps(xL, xL), _mm_mul_ps(yL, yL)),
+						_mm_mul_ps(zL, zL)));
+		xL = _mm_div_ps(xL, comprimento);
+		yL = _mm_div_ps(yL, comprimento);
+		zL = _mm_div_ps(zL, comprimento);
+
+		__m128 nX = carregarNormalSse2(s.normalX + k);
+		__m128 nY = carregarNormalSse2(s.normalY + k);
+		__m128 nZ = carregarNormalSse2(s.normalZ + k);
+		__m128 nDotL = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(nX, xL), _mm_mul_ps(nY, yL)),
+				_mm_mul_ps(nZ, zL));
+		__m128 difusa = _mm_max_ps(nDotL, zero);
+
+		__m128 mult = _mm_mul_ps(_mm_set1_ps(2), nDotL);
+		__m128 xR = _mm_sub_ps(_mm_mul_ps(mult, nX), xL);
+		__m128 yR = _mm_sub_ps(_mm_mul_ps(mult, nY), yL);
+		__m128 zR = _mm_sub_ps(_mm_mul_ps(mult, nZ), zL);
+		__m128 xO = converterSemSinalSse2(
+				_mm_sub_epi32(x, _mm_set1_epi32(s.tamX)));
+		__m128 yO = _mm_set1_ps(s.yObservador);
+		__m128 zO = _mm_add_ps(z, _mm_set1_ps(15));
+		comprimento = _mm_sqrt_ps(
+				_mm_add_ps(_mm_add_ps(_mm_mul_ps(xO, xO), _mm_mul_ps(yO, yO)),
+						_mm_mul_ps(zO, zO)));
+		__m128 rDotO = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(xR, _mm_div_ps(xO, comprimento)),
+						_mm_mul_ps(yR, _mm_div_ps(yO, comprimento))),
+				_mm_mul_ps(zR, _mm_div_ps(zO, comprimento)));
+		__m128 rDotO2 = _mm_mul_ps(rDotO, rDotO);
+		__m128 rDotO4 = _mm_mul_ps(rDotO2, rDotO2);
+		__m128i especular = _mm_cvttps_epi32(
+				_mm_mul_ps(_mm_set1_ps(s.kEspecular),
+						_mm_mul_ps(_mm_mul_ps(rDotO4, rDotO4), rDotO2)));
+		__m128i excede = _mm_cmpgt_epi32(especular, limite);
+		especular = _mm_or_si128(_mm_and_si128(excede, limite),
+				_mm_andnot_si128(excede, especular));
+
+		__m128i albedo = _mm_loadu_si128((const __m128i*) (s.albedos + k));
+		__m128i cor = _mm_set1_epi32(0xFF000000);
+
+		for (int deslocamento = 16; deslocamento >= 0; deslocamento -= 8) {
+			__m128 c = _mm_cvtepi32_ps(
+					_mm_and_si128(
+							_mm_srl_epi32(albedo,
+									_mm_cvtsi32_si128(deslocamento)),
+							mascaraCanal));
+			__m128i v = _mm_add_epi32(
+					_mm_add_epi32(
+							_mm_cvttps_epi32(
+									_mm_mul_ps(
+											_mm_mul_ps(
+													_mm_set1_ps(s.kDifusa), c),
+											difusa)), especular),
+					_mm_cvttps_epi32(_mm_mul_ps(_mm_set1_ps(s.kAmbiente), c)));
+			excede = _mm_cmpgt_epi32(v, limite);
+			v = _mm_or_si128(_mm_and_si128(excede, limite),
+					_mm_andnot_si128(excede, v));
+			cor = _mm_or_si128(cor,
+					_mm_sll_epi32(v, _mm_cvtsi32_si128(deslocamento)));
+		}
+
+		_mm_storeu_si128((__m128i*) (s.destino + k), cor);
+	}
+
+	iluminarEscalar(s, k, n);
+}
+
+__attribute__((target("avx2")))
+static void iluminarAvx2(const SequenciaIluminacao& s, const int n) {
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256i limite = _mm256_set1_epi32(255);
+	const __m256i mascaraCanal = _mm256_set1_epi32(0xFF);
+	const __m256 divisorNormal = _mm256_set1_ps(127.0f);
+	int k = 0;
+
+	for (; k + 8 <= n; k += 8) {
+		__m256i x = _mm256_add_epi32(_mm256_set1_epi32(s.x + k),
+				_mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+		__m256 z = _mm256_loadu_ps(s.profundidade + k);
+
+		__m256 xL = _mm256_sub_ps(_mm256_set1_ps(s.luzX), _mm256_cvtepi32_ps(x));
+		__m256 yL = _mm256_set1_ps(s.yLuz);
+		__m256 zL = _mm256_sub_ps(_mm256_set1_ps(s.luzZ), z);
+		__m256 comprimento = _mm256_sqrt_ps(
+				_mm256_add_ps(
+						_mm256_add_ps(_mm256_mul_ps(xL, xL),
+								_mm256_mul_ps(yL, yL)), _mm256_mul_ps(zL, zL)));
+		xL = _mm256_div_ps(xL, comprimento);
+		yL = _mm256_div_ps(yL, comprimento);
+		zL = _mm256_div_ps(zL, comprimento);
+
+		__m256 nX = _mm256_div_ps(
+				_mm256_cvtepi32_ps(
+						_mm256_cvtepi8_epi32(
+								_mm_loadl_epi64((const __m128i*) (s.normalX + k)))),
+				divisorNormal);
+		__m256 nY = _mm256_div_ps(
+				_mm256_cvtepi32_ps(
+						_mm256_cvtepi8_epi32(
+								_mm_loadl_epi64((const __m128i*) (s.normalY + k)))),
+				divisorNormal);
+		__m256 nZ = _mm256_div_ps(
+				_mm256_cvtepi32_ps(
+						_mm256_cvtepi8_epi32(
+								_mm_loadl_epi64((const __m128i*) (s.normalZ + k)))),
+				divisorNormal);
+		__m256 nDotL = _mm256_add_ps(
+				_mm256_add_ps(_mm256_mul_ps(nX, xL), _mm256_mul_ps(nY, yL)),
+				_mm256_mul_ps(nZ, zL));
+		__m256 difusa = _mm256_max_ps(nDotL, zero);
+
+		__m256 mult = _mm256_mul_ps(_mm256_set1_ps(2), nDotL);
+		__m256 xR = _mm256_sub_ps(_mm256_mul_ps(mult, nX), xL);
+		__m256 yR = _mm256_sub_ps(_mm256_mul_ps(mult, nY), yL);
+		__m256 zR = _mm256_sub_ps(_mm256_mul_ps(mult, nZ), zL);
+
+		// Conversão sem sinal com um único arredondamento
+		__m256i xRelativo = _mm256_sub_epi32(x, _mm256_set1_epi32(s.tamX));
+		__m256 xO = _mm256_add_ps(
+				_mm256_mul_ps(
+						_mm256_cvtepi32_ps(_mm256_srli_epi32(xRelativo, 16)),
+						_mm256_set1_ps(65536.0f)),
+				_mm256_cvtepi32_ps(
+						_mm256_and_si256(xRelativo,
+								_mm256_set1_epi32(0xFFFF))));
+		__m256 yO = _mm256_set1_ps(s.yObservador);
+		__m256 zO = _mm256_add_ps(z, _mm256_set1_ps(15));
+		comprimento = _mm256_sqrt_ps(
+				_mm256_add_ps(
+						_mm256_add_ps(_mm256_mul_ps(xO, xO),
+								_mm256_mul_ps(yO, yO)), _mm256_mul_ps(zO, zO)));
+		__m256 rDotO = _mm256_add_ps(
+				_mm256_add_ps(
+						_mm256_mul_ps(xR, _mm256_div_ps(xO, comprimento)),
+						_mm256_mul_ps(yR, _mm256_div_ps(yO, comprimento))),
+				_mm256_mul_ps(zR, _mm256_div_ps(zO, comprimento)));
+		__m256 rDotO2 = _mm256_mul_ps(rDotO, rDotO);
+		__m256 rDotO4 = _mm256_mul_ps(rDotO2, rDotO2);
+		__m256i especular = _mm256_min_epi32(
+				_mm256_cvttps_epi32(
+						_mm256_mul_ps(_mm256_set1_ps(s.kEspecular),
+								_mm256_mul_ps(_mm256_mul_ps(rDotO4, rDotO4),
+										rDotO2))), limite);
+
+		__m256i albedo = _mm256_loadu_si256((const __m256i*) (s.albedos + k));
+		__m256i cor = _mm256_set1_epi32(0xFF000000);
+
+		for (int deslocamento = 16; deslocamento >= 0; deslocamento -= 8) {
+			__m256 c = _mm256_cvtepi32_ps(
+					_mm256_and_si256(
+							_mm256_srl_epi32(albedo,
+									_mm_cvtsi32_si128(deslocamento)),
+							mascaraCanal));
+			__m256i v = _mm256_add_epi32(
+					_mm256_add_epi32(
+							_mm256_cvttps_epi32(
+									_mm256_mul_ps(
+											_mm256_mul_ps(
+													_mm256_set1_ps(s.kDifusa),
+													c), difusa)), especular),
+					_mm256_cvttps_epi32(
+							_mm256_mul_ps(_mm256_set1_ps(s.kAmbiente), c)));
+			cor = _mm256_or_si256(cor,
+					_mm256_sll_epi32(_mm256_min_epi32(v, limite),
+							_mm_cvtsi32_si128(deslocamento)));
+		}
+
+		_mm256_storeu_si256((__m256i*) (s.destino + k), cor);
 	}
-	return QColor(rEsp, gEsp, bEsp);
+
+	iluminarEscalar(s, k, n);
 }
 
-QColor Iluminador::calcularComponenteAmbiente(Pixel p) {
-	QColor cor = p.getCor();
-	int r;
-	int g;
-	int b;
-	int a;
-	cor.getRgb(&r, &g, &b, &a);
-	double kA = 0.4;
-	int rAmb = (int) (kA * r);
-	int gAmb = (int) (kA * g);
-	int bAmb = (int) (kA * b);
-	return QColor(rAmb, gAmb, bAmb);
+#endif /* ILUMINACAO_X86 */
+
+void Iluminador::iluminarSequencia(const unsigned int x, const unsigned int y,
+		const int n, const float* const profundidade,
+		const signed char* const normalX, const signed char* const normalY,
+		const signed char* const normalZ, const QRgb* const albedos,
+		QRgb* const destino) const {
+	SequenciaIluminacao s;
+	s.x = x;
+	s.tamX = this->tamX;
+	s.luzX = this->fonteDeLuz.getX();
+	s.luzZ = this->fonteDeLuz.getZ();
+	s.yLuz = (float) this->fonteDeLuz.getY() - (float) y;
+	s.yObservador = (float) (y - this->tamY);
+	s.kDifusa = K_DIFUSA;
+	s.kEspecular = K_ESPECULAR * 255;
+	s.kAmbiente = K_AMBIENTE;
+	s.profundidade = profundidade;
+	s.normalX = normalX;
+	s.normalY = normalY;
+	s.normalZ = normalZ;
+	s.albedos = albedos;
+	s.destino = destino;
+
+	switch (KernelsFragmentos::getConjuntoInstrucoes()) {
+#ifdef ILUMINACAO_X86
+	case KernelsFragmentos::AVX2:
+		iluminarAvx2(s, n);
+		break;
+	case KernelsFragmentos::SSE2:
+		iluminarSse2(s, n);
+		break;
+#endif
+	default:
+		iluminarEscalar(s, 0, n);
+		break;
+	}
 }
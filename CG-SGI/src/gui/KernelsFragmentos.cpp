@@ -0,0 +1,269 @@
+#include "gui/KernelsFragmentos.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define KERNELS_X86
+#include <immintrin.h>
+#endif
+
+KernelsFragmentos::ConjuntoInstrucoes KernelsFragmentos::conjunto =
+		KernelsFragmentos::detectarSuporte();
+
+static unsigned int calcularCoberturaEscalar(const int* const w,
+		const int* const passoX, const int n) {
+	unsigned int mascara = 0;
+
+	for (int k = 0; k < n; k++) {
+		int w0 = w[0] + k * passoX[0];
+		int w1 = w[1] + k * passoX[1];
+		int w2 = w[2] + k * passoX[2];
+
+		if ((w0 | w1 | w2) >= 0)
+			mascara |= 1u << k;
+	}
+
+	return mascara;
+}
+
+static int escreverFragmentosEscalar(float* const profundidade,
+		unsigned int* const facetas, signed char* const normalX,
+		signed char* const normalY, signed char* const normalZ, const int n,
+		const unsigned int mascara, const float z, const float dz,
+		const int indice, const unsigned int faceta, const signed char nX,
+		const signed char nY, const signed char nZ) {
+	int escritos = 0;
+
+	for (int k = 0; k < n; k++) {
+		if (!(mascara & (1u << k)))
+			continue;
+
+		float zPix = z + (float) (indice + k) * dz;
+
+		if (!(zPix < profundidade[k]))
+			continue;
+
+		profundidade[k] = zPix;
+		facetas[k] = faceta;
+		escritos++;
+
+		if (normalX) {
+			normalX[k] = nX;
+			normalY[k] = nY;
+			normalZ[k] = nZ;
+		}
+	}
+
+	return escritos;
+}
+
+#ifdef KERNELS_X86
+
+/**
+ * Escrever as normais dos pixels aprovados, indicados por uma máscara.
+ */
+static void escreverNormais(signed char* const normalX,
+		signed char* const normalY, signed char* const normalZ,
+		unsigned int aprovados, const signed char nX, const signed char nY,
+		const signed char nZ) {
+	if (!normalX)
+		return;
+
+	while (aprovados) {
+		int k = __builtin_ctz(aprovados);
+		normalX[k] = nX;
+		normalY[k] = nY;
+		normalZ[k] = nZ;
+		aprovados &= aprovados - 1;
+	}
+}
+
+__attribute__((target("sse2")))
+static unsigned int calcularCoberturaSse2(const int* const w,
+		const int* const passoX, const int n) {
+	__m128i negativos[2] = { _mm_setzero_si128(), _mm_setzero_si128() };
+
+	for (int i = 0; i < 3; i++) {
+		int p = passoX[i];
+		__m128i v = _mm_set_epi32(w[i] + 3 * p, w[i] + 2 * p, w[i] + p, w[i]);
+		__m128i quatroPassos = _mm_set1_epi32(4 * p);
+		negativos[0] = _mm_or_si128(negativos[0], v);
+		negativos[1] = _mm_or_si128(negativos[1],
+				_mm_add_epi32(v, quatroPassos));
+	}
+
+	// Bit de sinal de (w0 | w1 | w2) ligado indica pixel fora do triângulo
+	unsigned int fora = _mm_movemask_ps(_mm_castsi128_ps(negativos[0]))
+			| (_mm_movemask_ps(_mm_castsi128_ps(negativos[1])) << 4);
+
+	return ~fora & ((1u << n) - 1);
+}
+
+__attribute__((target("sse2")))
+static int escreverFragmentosSse2(float* const profundidade,
+		unsigned int* const facetas, signed char* const normalX,
+		signed char* const normalY, signed char* const normalZ, const int n,
+		const unsigned int mascara, const float z, const float dz,
+		const int indice, const unsigned int faceta, const signed char nX,
+		const signed char nY, const signed char nZ) {
+	const __m128 vZ = _mm_set1_ps(z);
+	const __m128 vDz = _mm_set1_ps(dz);
+	const __m128i vFaceta = _mm_set1_epi32(faceta);
+	const __m128i bits = _mm_set_epi32(8, 4, 2, 1);
+	int escritos = 0;
+	int k = 0;
+
+	for (; k + 4 <= n; k += 4) {
+		unsigned int cobertos = (mascara >> k) & 0xF;
+
+		if (!cobertos)
+			continue;
+
+		__m128i indices = _mm_add_epi32(_mm_set1_epi32(indice + k),
+				_mm_set_epi32(3, 2, 1, 0));
+		__m128 zPix = _mm_add_ps(vZ, _mm_mul_ps(_mm_cvtepi32_ps(indices), vDz));
+		__m128 zAtual = _mm_loadu_ps(profundidade + k);
+		__m128i mCobertos = _mm_cmpeq_epi32(
+				_mm_and_si128(_mm_set1_epi32(cobertos), bits), bits);
+		__m128 aprovado = _mm_and_ps(_mm_cmplt_ps(zPix, zAtual),
+				_mm_castsi128_ps(mCobertos));
+		unsigned int aprovados = _mm_movemask_ps(aprovado);
+
+		if (!aprovados)
+			continue;
+
+		__m128i mAprovado = _mm_castps_si128(aprovado);
+		__m128i facetaAtual = _mm_loadu_si128((__m128i*) (facetas + k));
+		_mm_storeu_ps(profundidade + k,
+				_mm_or_ps(_mm_and_ps(aprovado, zPix),
+						_mm_andnot_ps(aprovado, zAtual)));
+		_mm_storeu_si128((__m128i*) (facetas + k),
+				_mm_or_si128(_mm_and_si128(mAprovado, vFaceta),
+						_mm_andnot_si128(mAprovado, facetaAtual)));
+		escreverNormais(normalX ? normalX + k : 0, normalY ? normalY + k : 0,
+				normalZ ? normalZ + k : 0, aprovados, nX, nY, nZ);
+		escritos += __builtin_popcount(aprovados);
+	}
+
+	// Pixels restantes, fora de um grupo completo de 4
+	if (k < n)
+		escritos += escreverFragmentosEscalar(profundidade + k, facetas + k,
+				normalX ? normalX + k : 0, normalY ? normalY + k : 0,
+				normalZ ? normalZ + k : 0, n - k, mascara >> k, z, dz,
+				indice + k, faceta, nX, nY, nZ);
+
+	return escritos;
+}
+
+__attribute__((target("avx2")))
+static unsigned int calcularCoberturaAvx2(const int* const w,
+		const int* const passoX, const int n) {
+	const __m256i colunas = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+	__m256i negativos = _mm256_setzero_si256();
+
+	for (int i = 0; i < 3; i++)
+		negativos = _mm256_or_si256(negativos,
+				_mm256_add_epi32(_mm256_set1_epi32(w[i]),
+						_mm256_mullo_epi32(colunas,
+								_mm256_set1_epi32(passoX[i]))));
+
+	unsigned int fora = _mm256_movemask_ps(_mm256_castsi256_ps(negativos));
+
+	return ~fora & ((1u << n) - 1);
+}
+
+__attribute__((target("avx2")))
+static int escreverFragmentosAvx2(float* const profundidade,
+		unsigned int* const facetas, signed char* const normalX,
+		signed char* const normalY, signed char* const normalZ, const int n,
+		const unsigned int mascara, const float z, const float dz,
+		const int indice, const unsigned int faceta, const signed char nX,
+		const signed char nY, const signed char nZ) {
+	const __m256i colunas = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+	const __m256i bits = _mm256_sllv_epi32(_mm256_set1_epi32(1), colunas);
+
+	// Somente as n primeiras colunas são lidas ou escritas
+	__m256i mColunas = _mm256_cmpgt_epi32(_mm256_set1_epi32(n), colunas);
+	__m256i mCobertos = _mm256_and_si256(mColunas,
+			_mm256_cmpeq_epi32(
+					_mm256_and_si256(_mm256_set1_epi32(mascara), bits), bits));
+
+	__m256 zPix = _mm256_add_ps(_mm256_set1_ps(z),
+			_mm256_mul_ps(
+					_mm256_cvtepi32_ps(
+							_mm256_add_epi32(_mm256_set1_epi32(indice),
+									colunas)), _mm256_set1_ps(dz)));
+	__m256 zAtual = _mm256_maskload_ps(profundidade, mColunas);
+	__m256 aprovado = _mm256_and_ps(_mm256_cmp_ps(zPix, zAtual, _CMP_LT_OQ),
+			_mm256_castsi256_ps(mCobertos));
+	unsigned int aprovados = _mm256_movemask_ps(aprovado);
+
+	if (!aprovados)
+		return 0;
+
+	__m256i mAprovado = _mm256_castps_si256(aprovado);
+	_mm256_maskstore_ps(profundidade, mAprovado, zPix);
+	_mm256_maskstore_epi32((int*) facetas, mAprovado, _mm256_set1_epi32(faceta));
+	escreverNormais(normalX, normalY, normalZ, aprovados, nX, nY, nZ);
+
+	return __builtin_popcount(aprovados);
+}
+
+#endif /* KERNELS_X86 */
+
+KernelsFragmentos::ConjuntoInstrucoes KernelsFragmentos::detectarSuporte() {
+#ifdef KERNELS_X86
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx2"))
+		return AVX2;
+
+	if (__builtin_cpu_supports("sse2"))
+		return SSE2;
+#endif
+
+	return ESCALAR;
+}
+
+KernelsFragmentos::ConjuntoInstrucoes KernelsFragmentos::getConjuntoInstrucoes() {
+	return conjunto;
+}
+
+void KernelsFragmentos::setConjuntoInstrucoes(
+		const ConjuntoInstrucoes conjunto) {
+	ConjuntoInstrucoes suportado = detectarSuporte();
+	KernelsFragmentos::conjunto = conjunto > suportado ? suportado : conjunto;
+}
+
+unsigned int KernelsFragmentos::calcularCobertura(const int* const w,
+		const int* const passoX, const int n) {
+	switch (conjunto) {
+#ifdef KERNELS_X86
+	case AVX2:
+		return calcularCoberturaAvx2(w, passoX, n);
+	case SSE2:
+		return calcularCoberturaSse2(w, passoX, n);
+#endif
+	default:
+		return calcularCoberturaEscalar(w, passoX, n);
+	}
+}
+
+int KernelsFragmentos::escreverFragmentos(float* const profundidade,
+		unsigned int* const facetas, signed char* const normalX,
+		signed char* const normalY, signed char* const normalZ, const int n,
+		const unsigned int mascara, const float z, const float dz,
+		const int indice, const unsigned int faceta, const signed char nX,
+		const signed char nY, const signed char nZ) {
+	switch (conjunto) {
+#ifdef KERNELS_X86
+	case AVX2:
+		return escreverFragmentosAvx2(profundidade, facetas, normalX, normalY,
+				normalZ, n, mascara, z, dz, indice, faceta, nX, nY, nZ);
+	case SSE2:
+		return escreverFragmentosSse2(profundidade, facetas, normalX, normalY,
+				normalZ, n, mascara, z, dz, indice, faceta, nX, nY, nZ);
+#endif
+	default:
+		return escreverFragmentosEscalar(profundidade, facetas, normalX, normalY,
+				normalZ, n, mascara, z, dz, indice, faceta, nX, nY, nZ);
+	}
+}
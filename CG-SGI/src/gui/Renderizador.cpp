@@ -0,0 +1,920 @@
+#include "gui/Renderizador.h"
+#include "util/Desempenho.h"
+#include "util/Log.h"
+#include "util/Rastreamento.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <numeric>
+
+// Fração da extensão em profundidade de um objeto que as suas arestas são
+// aproximadas do observador na remoção de linhas ocultas
+static const double DESLOCAMENTO_ARESTAS = 0.01;
+
+// Definições das constantes, que std::min recebe por referência
+const int Renderizador::TAMANHO_TILE;
+const int Renderizador::ALTURA_FAIXA;
+const int Renderizador::TRIANGULOS_BLOCO;
+
+Renderizador::Renderizador(const unsigned int largura,
+		const unsigned int altura, const unsigned int margemClipping,
+		const unsigned int numThreads) {
+	this->largura = largura;
+	this->altura = altura;
+	this->margemClipping = margemClipping;
+	this->areaClipping = QRect(margemClipping, margemClipping + 1,
+			largura - 2 * margemClipping + 1, altura - 2 * margemClipping);
+	this->tilesX = (largura + TAMANHO_TILE - 1) / TAMANHO_TILE;
+	this->tilesY = (altura + TAMANHO_TILE - 1) / TAMANHO_TILE;
+	this->corFundo = qRgb(255, 255, 255);
+	this->modoSombreamento = PHONG;
+	this->modoOrdenacao = FRENTE_PARA_TRAS;
+	this->modoPreenchimento = SOLIDO;
+	this->descarteFacesTraseiras = true;
+	this->numFacetas = 0;
+	this->numFacetasDescartadas = 0;
+	this->clipping = 0;
+	this->rasterizador = 0;
+	this->iluminador = new Iluminador(this->largura, this->altura);
+	this->frameBuffer = new FrameBuffer(this->largura, this->altura);
+	this->pool = new PoolThreads(numThreads);
+	this->triangulosPorTile.resize(this->tilesX * this->tilesY);
+	this->segmentosPorTile.resize(this->tilesX * this->tilesY);
+	this->triangulosOcultosPorTile.resize(this->tilesX * this->tilesY, 0);
+	this->setAlgoritmoClippingLinhas(Clipping::COHEN_SUTHERLAND);
+	this->setAlgoritmoRasterizacao(Rasterizador::SCANLINE);
+}
+
+Renderizador::~Renderizador() {
+	delete this->pool;
+
+	if (this->clipping)
+		delete this->clipping;
+
+	if (this->rasterizador)
+		delete this->rasterizador;
+
+	delete this->iluminador;
+	delete this->frameBuffer;
+}
+
+void Renderizador::renderizar(const QList<ObjetoGeometrico*>& objetos,
+		QImage* const imagem) {
+	this->prepararTriangulos(objetos);
+	this->distribuirTriangulos();
+
+	uchar* bits = imagem->bits();
+	int bytesPorLinha = imagem->bytesPerLine();
+
+	// As etapas paralelas são medidas pela thread que as submete
+	{
+		Desempenho::Cronometro cronometro(Desempenho::RASTERIZACAO);
+		this->pool->executar(this->tilesX * this->tilesY,
+				[this](unsigned int tile) {
+					Rastreamento::Intervalo intervalo("tile", "rasterizacao",
+							tile);
+					this->rasterizarTile(tile);
+				});
+	}
+
+	{
+		Desempenho::Cronometro cronometro(Desempenho::ILUMINACAO);
+		this->pool->executar((this->altura + ALTURA_FAIXA - 1) / ALTURA_FAIXA,
+				[this, bits, bytesPorLinha](unsigned int faixa) {
+					Rastreamento::Intervalo intervalo("faixa", "iluminacao",
+							faixa);
+					this->iluminarFaixa(faixa, bits, bytesPorLinha);
+				});
+	}
+
+	unsigned long testados = this->frameBuffer->getNumFragmentosTestados();
+	Desempenho::contar(Desempenho::OBJETOS, objetos.size());
+	Desempenho::contar(Desempenho::FACETAS, this->numFacetas);
+	Desempenho::contar(Desempenho::TRIANGULOS, this->triangulos.size());
+	Desempenho::contar(Desempenho::FRAGMENTOS, testados);
+	Desempenho::contar(Desempenho::REJEICOES_PROFUNDIDADE,
+			testados - this->frameBuffer->getNumFragmentosEscritos());
+
+	LOG_DEPURACAO(Log::RENDERIZACAO,
+			"quadro: %d triângulos, %u de %u facetas descartadas, "
+			"%u triângulos ocultos, %.1f%% dos fragmentos rejeitados",
+			this->triangulos.size(), this->numFacetasDescartadas,
+			this->numFacetas, this->getNumTriangulosOcultos(),
+			this->getTaxaRejeicaoProfundidade() * 100);
+}
+
+void Renderizador::setAlgoritmoClippingLinhas(
+		Clipping::AlgoritmoClippingLinha algoritmo) {
+	if (this->clipping)
+		delete this->clipping;
+
+	double larguraD = (double) this->largura;
+	double alturaD = (double) this->altura;
+
+	double xvMin = 2 * this->margemClipping / larguraD - 1;
+	double xvMax = 2 * (larguraD - this->margemClipping) / larguraD - 1;
+	double yvMin = 2 * this->margemClipping / alturaD - 1;
+	double yvMax = 2 * (alturaD - this->margemClipping - 1) / alturaD - 1;
+
+	switch (algoritmo) {
+	case Clipping::COHEN_SUTHERLAND:
+		this->clipping = new ClippingCohenSutherland(xvMin, xvMax, yvMin,
+				yvMax);
+		break;
+	case Clipping::LIANG_BARSKY:
+		this->clipping = new ClippingLiangBarsky(xvMin, xvMax, yvMin, yvMax);
+		break;
+	}
+}
+
+void Renderizador::setAlgoritmoRasterizacao(
+		Rasterizador::AlgoritmoRasterizacao algoritmo) {
+	if (this->rasterizador)
+		delete this->rasterizador;
+
+	switch (algoritmo) {
+	case Rasterizador::SCANLINE:
+		this->rasterizador = new RasterizadorScanline(this->largura,
+				this->altura);
+		break;
+	case Rasterizador::SEMI_PLANO:
+		this->rasterizador = new RasterizadorSemiPlano(this->largura,
+				this->altura);
+		break;
+	}
+}
+
+void Renderizador::setModoSombreamento(const ModoSombreamento modo) {
+	this->modoSombreamento = modo;
+}
+
+Renderizador::ModoSombreamento Renderizador::getModoSombreamento() const {
+	return this->modoSombreamento;
+}
+
+void Renderizador::setModoOrdenacao(const ModoOrdenacao modo) {
+	this->modoOrdenacao = modo;
+}
+
+Renderizador::ModoOrdenacao Renderizador::getModoOrdenacao() const {
+	return this->modoOrdenacao;
+}
+
+void Renderizador::setModoPreenchimento(const ModoPreenchimento modo) {
+	this->modoPreenchimento = modo;
+}
+
+Renderizador::ModoPreenchimento Renderizador::getModoPreenchimento() const {
+	return this->modoPreenchimento;
+}
+
+void Renderizador::setDescarteFacesTraseiras(const bool descarte) {
+	this->descarteFacesTraseiras = descarte;
+}
+
+bool Renderizador::isDescarteFacesTraseiras() const {
+	return this->descarteFacesTraseiras;
+}
+
+unsigned int Renderizador::getNumFacetas() const {
+	return this->numFacetas;
+}
+
+unsigned int Renderizador::getNumFacetasDescartadas() const {
+	return this->numFacetasDescartadas;
+}
+
+unsigned long Renderizador::getNumFragmentosTestados() const {
+	return this->frameBuffer->getNumFragmentosTestados();
+}
+
+double Renderizador::getTaxaRejeicaoProfundidade() const {
+	unsigned long testados = this->frameBuffer->getNumFragmentosTestados();
+
+	if (testados == 0)
+		return 0;
+
+	return 1 - (double) this->frameBuffer->getNumFragmentosEscritos()
+			/ testados;
+}
+
+unsigned int Renderizador::getNumTriangulosOcultos() const {
+	return std::accumulate(this->triangulosOcultosPorTile.begin(),
+			this->triangulosOcultosPorTile.end(), 0u);
+}
+
+unsigned int Renderizador::getNumThreads() const {
+	return this->pool->getNumThreads();
+}
+
+const FrameBuffer* Renderizador::getFrameBuffer() const {
+	return this->frameBuffer;
+}
+
+void Renderizador::prepararTriangulos(const QList<ObjetoGeometrico*>& objetos) {
+	this->triangulos.clear();
+	this->facetasTriangulos.clear();
+	this->coresFacetas.clear();
+	this->normaisFacetas.clear();
+	this->coresIluminadas.clear();
+	this->gradientesCores.clear();
+	this->objetosRenderizados.clear();
+	this->blocosFacetas.clear();
+	this->objetosBlocos.clear();
+	this->blocosTriangulos.clear();
+	this->segmentos.clear();
+	this->coresLinhas.clear();
+	this->numFacetas = 0;
+	this->numFacetasDescartadas = 0;
+
+	for (int i = 0; i < objetos.size(); i++) {
+		ObjetoGeometrico::Tipo tipo = objetos.at(i)->getTipo();
+
+		// Curvas são recortadas segmento a segmento da sua tesselação
+		if (tipo == ObjetoGeometrico::CURVA_BEZIER
+				|| tipo == ObjetoGeometrico::CURVA_BSPLINE) {
+			Desempenho::Cronometro cronometro(Desempenho::CLIPPING);
+			this->recortarPolilinha(objetos.at(i)->getPontos(),
+					objetos.at(i)->getCor());
+			continue;
+		}
+
+		// Nos modos aramados as facetas só são preparadas para ocultar arestas
+		if (tipo == ObjetoGeometrico::OBJETO3D
+				&& this->modoPreenchimento != SOLIDO) {
+			Desempenho::Cronometro cronometro(Desempenho::TRIANGULACAO);
+			this->adicionarArestas((const Objeto3D*) objetos.at(i));
+
+			if (this->modoPreenchimento == ARAMADO)
+				continue;
+		}
+
+		ObjetoGeometrico* objeto;
+		ObjetoGeometrico* objetoRecortado;
+
+		{
+			Desempenho::Cronometro cronometro(Desempenho::CLIPPING);
+			objeto = objetos.at(i)->clonar();
+			objetoRecortado = this->clipping->clip(objeto);
+		}
+
+		// Objeto está fora da window
+		if (objetoRecortado == 0) {
+			LOG_DEPURACAO(Log::CLIPPING, "objeto '%s' fora da window",
+					objeto->getNome().c_str());
+			delete objeto;
+			continue;
+		}
+
+		Desempenho::Cronometro cronometro(Desempenho::TRIANGULACAO);
+
+		// Cada faceta (ou objeto 2D) recebe uma entrada na tabela de materiais
+		if (objetoRecortado->getTipo() == ObjetoGeometrico::OBJETO3D) {
+			Objeto3D* objeto3D = (Objeto3D*) objetoRecortado;
+			const Malha& malha = objeto3D->getMalha();
+			bool descartar = this->descarteFacesTraseiras
+					&& objeto3D->isDescarteFacesTraseiras();
+			this->iniciarBloco(true);
+			this->objetosRenderizados.last().somenteProfundidade =
+					this->modoPreenchimento == LINHAS_OCULTAS;
+
+			for (int f = 0; f < malha.getNumFacetas(); f++) {
+				this->numFacetas++;
+				Ponto normal = malha.getNormal(f);
+
+				// As normais são recalculadas após a projeção, então o sinal
+				// de z dá a orientação da faceta na tela
+				if (descartar && normal.getZ() > 0) {
+					this->numFacetasDescartadas++;
+					continue;
+				}
+
+				this->iniciarBloco(false);
+				this->adicionarTriangulos(malha.getPontosFaceta(f),
+						malha.getTriangulacao(f), malha.getCor(f), normal,
+						malha.getNormaisVertices(f));
+			}
+		} else if (objetoRecortado->getTipo() == ObjetoGeometrico::POLIGONO) {
+			Poligono* poligono = (Poligono*) objetoRecortado;
+			QList<Ponto> pontos = poligono->getPontos();
+			this->iniciarBloco(true);
+			this->adicionarTriangulos(pontos, poligono->getTriangulacao(),
+					poligono->getCor(), Faceta::calcularVetorNormal(pontos),
+					QList<Ponto>());
+		} else if (objetoRecortado->getTipo() == ObjetoGeometrico::RETA) {
+			this->adicionarLinhas(objetoRecortado->getPontos(),
+					objetoRecortado->getCor());
+		} else if (objetoRecortado->getTipo() == ObjetoGeometrico::PONTO) {
+			Ponto* ponto = (Ponto*) objetoRecortado;
+			this->adicionarLinhas({ *ponto, *ponto }, ponto->getCor());
+		}
+
+		delete objetoRecortado;
+
+		if (objetoRecortado != objeto)
+			delete objeto;
+	}
+
+	// No sombreamento de Gouraud as linhas seguem os triângulos na tabela de
+	// gradientes, com a cor constante
+	if (this->modoSombreamento == GOURAUD)
+		for (QRgb cor : this->coresLinhas)
+			for (int deslocamento = 16; deslocamento >= 0; deslocamento -= 8) {
+				this->gradientesCores.append((cor >> deslocamento) & 0xFF);
+				this->gradientesCores.append(0);
+				this->gradientesCores.append(0);
+			}
+}
+
+void Renderizador::adicionarTriangulos(const QList<Ponto>& pontos,
+		const QVector<int>& indices, const QColor& corFaceta,
+		const Ponto& normal, const QList<Ponto>& normaisVertices) {
+	unsigned int faceta = this->coresFacetas.size();
+	QRgb cor = corFaceta.rgb();
+
+	// Normal orientada para o observador (z negativo); as normais dos
+	// vértices acompanham a orientação da faceta
+	double nX, nY, nZ;
+	this->converterNormal(normal, &nX, &nY, &nZ);
+	bool invertida = nZ > 0;
+
+	if (invertida) {
+		nX = -nX;
+		nY = -nY;
+		nZ = -nZ;
+	}
+
+	this->coresFacetas.append(cor);
+	this->normaisFacetas.append(nX);
+	this->normaisFacetas.append(nY);
+	this->normaisFacetas.append(nZ);
+
+	if (this->modoSombreamento == FLAT) {
+		double x = 0, y = 0, z = 0;
+
+		for (const Ponto& p : pontos) {
+			x += p.getX();
+			y += p.getY();
+			z += p.getZ();
+		}
+
+		int n = std::max(pontos.size(), 1);
+		this->coresIluminadas.append(
+				this->iluminarPonto(Ponto("", x / n, y / n, z / n), cor, nX,
+						nY, nZ));
+	}
+
+	for (int k = 0; k + 2 < indices.size(); k += 3) {
+		QList<Ponto> vertices = { pontos.at(indices.at(k)),
+				pontos.at(indices.at(k + 1)), pontos.at(indices.at(k + 2)) };
+
+		this->triangulos.append(Poligono("", vertices, corFaceta));
+		this->facetasTriangulos.append(faceta);
+		this->blocosTriangulos.append(this->blocosFacetas.size() - 1);
+		this->blocosFacetas.last().fim = this->triangulos.size();
+		this->objetosRenderizados.last().fim = this->triangulos.size();
+
+		if (this->modoSombreamento != GOURAUD)
+			continue;
+
+		QRgb cores[3];
+
+		for (int i = 0; i < 3; i++) {
+			double vX = nX, vY = nY, vZ = nZ;
+			int indice = indices.at(k + i);
+
+			if (indice < normaisVertices.size()) {
+				this->converterNormal(normaisVertices.at(indice), &vX, &vY,
+						&vZ);
+
+				if (invertida) {
+					vX = -vX;
+					vY = -vY;
+					vZ = -vZ;
+				}
+			}
+
+			cores[i] = this->iluminarPonto(vertices.at(i), cor, vX, vY, vZ);
+		}
+
+		this->adicionarGradienteCores(vertices, cores);
+	}
+}
+
+void Renderizador::adicionarLinhas(const QList<Ponto>& extremos,
+		const QColor& corLinha) {
+	if (extremos.isEmpty())
+		return;
+
+	double x = 0, y = 0, z = 0;
+
+	for (const Ponto& p : extremos) {
+		x += p.getX();
+		y += p.getY();
+		z += p.getZ();
+	}
+
+	int n = extremos.size();
+	unsigned int faceta = this->adicionarCorLinha(
+			Ponto("", x / n, y / n, z / n), corLinha);
+
+	for (int k = 0; k + 1 < extremos.size(); k += 2) {
+		Segmento segmento = { extremos.at(k), extremos.at(k + 1), faceta,
+				(unsigned int) this->coresLinhas.size() - 1, k > 0
+						&& extremos.at(k - 1) == extremos.at(k) };
+		this->segmentos.append(segmento);
+	}
+}
+
+unsigned int Renderizador::adicionarCorLinha(const Ponto& centro,
+		const QColor& corLinha) {
+	unsigned int faceta = this->coresFacetas.size();
+	QRgb cor = corLinha.rgb();
+
+	// Linhas não têm orientação: são sombreadas como voltadas para o
+	// observador, com a iluminação do seu centro nos modos flat e Gouraud
+	QRgb corIluminada = this->iluminarPonto(centro, cor, 0, 0, -1);
+
+	this->coresFacetas.append(cor);
+	this->normaisFacetas.append(0);
+	this->normaisFacetas.append(0);
+	this->normaisFacetas.append(-1);
+
+	if (this->modoSombreamento == FLAT)
+		this->coresIluminadas.append(corIluminada);
+
+	this->coresLinhas.append(corIluminada);
+
+	return faceta;
+}
+
+void Renderizador::adicionarArestas(const Objeto3D* const objeto) {
+	QList<Ponto> pontos = objeto->getPontos();
+	QVector<int> arestas = objeto->getArestas();
+	double deslocamento = 0;
+
+	if (this->modoPreenchimento == LINHAS_OCULTAS && !pontos.isEmpty()) {
+		double zMinimo = pontos.at(0).getZ();
+		double zMaximo = zMinimo;
+
+		for (const Ponto& p : pontos) {
+			zMinimo = std::min(zMinimo, p.getZ());
+			zMaximo = std::max(zMaximo, p.getZ());
+		}
+
+		deslocamento = DESLOCAMENTO_ARESTAS * (zMaximo - zMinimo);
+	}
+
+	QList<Ponto> extremos;
+
+	for (int k = 0; k < arestas.size(); k++) {
+		Ponto p = pontos.at(arestas.at(k));
+		p.setZ(p.getZ() - deslocamento);
+		extremos.append(p);
+	}
+
+	this->adicionarLinhas(extremos, objeto->getCor());
+}
+
+void Renderizador::recortarPolilinha(const QList<Ponto>& pontos,
+		const QColor& corLinha) {
+	int inicio = this->segmentos.size();
+	unsigned int faceta = this->coresFacetas.size();
+	unsigned int linha = this->coresLinhas.size();
+	double x = 0, y = 0, z = 0;
+
+	for (int i = 1; i < pontos.size(); i++) {
+		const Ponto& a = pontos.at(i - 1);
+		const Ponto& b = pontos.at(i);
+		double p1[3] = { a.getX(), a.getY(), a.getZ() };
+		double p2[3] = { b.getX(), b.getY(), b.getZ() };
+
+		if (!this->clipping->clipSegmento(p1, p2))
+			continue;
+
+		// Segmento que começa no fim do anterior não repete o pixel comum
+		bool continuacao = false;
+
+		if (this->segmentos.size() > inicio) {
+			const Ponto& fim = this->segmentos.last().fim;
+			continuacao = fim.getX() == p1[0] && fim.getY() == p1[1]
+					&& fim.getZ() == p1[2];
+		}
+
+		Segmento segmento = { Ponto("", p1[0], p1[1], p1[2]), Ponto("",
+				p2[0], p2[1], p2[2]), faceta, linha, continuacao };
+		this->segmentos.append(segmento);
+		x += p1[0] + p2[0];
+		y += p1[1] + p2[1];
+		z += p1[2] + p2[2];
+	}
+
+	// A cor é registrada depois, iluminada no centro dos segmentos visíveis
+	int n = 2 * (this->segmentos.size() - inicio);
+
+	if (n > 0)
+		this->adicionarCorLinha(Ponto("", x / n, y / n, z / n), corLinha);
+}
+
+void Renderizador::iniciarBloco(const bool novoObjeto) {
+	unsigned int inicio = this->triangulos.size();
+	GrupoTriangulos grupo = { inicio, inicio, FLT_MAX, -FLT_MAX, QRect(),
+			false };
+
+	if (novoObjeto)
+		this->objetosRenderizados.append(grupo);
+	else if (this->blocosFacetas.last().fim - this->blocosFacetas.last().inicio
+			< (unsigned int) TRIANGULOS_BLOCO)
+		return;
+
+	this->blocosFacetas.append(grupo);
+	this->objetosBlocos.append(this->objetosRenderizados.size() - 1);
+}
+
+void Renderizador::converterNormal(const Ponto& normal, double* nX,
+		double* nY, double* nZ) const {
+	// Normais são transformadas pela inversa transposta da escala da viewport
+	double x = normal.getX() / ((double) this->largura / 2);
+	double y = normal.getY() / ((double) this->altura / 2);
+	double z = normal.getZ();
+	double comprimento = sqrt(x * x + y * y + z * z);
+
+	if (comprimento == 0 || !std::isfinite(comprimento))
+		comprimento = 1;
+
+	*nX = x / comprimento;
+	*nY = y / comprimento;
+	*nZ = z / comprimento;
+}
+
+QRgb Renderizador::iluminarPonto(const Ponto& ponto, const QRgb cor,
+		const double nX, const double nY, const double nZ) const {
+	double x = (ponto.getX() + 1) * this->largura / 2;
+	double y = this->altura - (ponto.getY() + 1) * this->altura / 2;
+
+	if (!std::isfinite(x) || !std::isfinite(y))
+		return cor;
+
+	// Pontos fora da imagem são aproximados pela borda estendida
+	int pixelX = floor(std::max(-1.0 * this->largura,
+			std::min(2.0 * this->largura, x)));
+	int pixelY = floor(std::max(-1.0 * this->altura,
+			std::min(2.0 * this->altura, y)));
+
+	return this->iluminador->iluminar(pixelX, pixelY, ponto.getZ(), cor, nX,
+			nY, nZ);
+}
+
+void Renderizador::adicionarGradienteCores(const QList<Ponto>& vertices,
+		const QRgb cores[3]) {
+	double x[3], y[3];
+
+	for (int i = 0; i < 3; i++) {
+		x[i] = (vertices.at(i).getX() + 1) * this->largura / 2;
+		y[i] = this->altura - (vertices.at(i).getY() + 1) * this->altura / 2;
+	}
+
+	double x1 = x[1] - x[0];
+	double y1 = y[1] - y[0];
+	double x2 = x[2] - x[0];
+	double y2 = y[2] - y[0];
+	double det = x1 * y2 - x2 * y1;
+
+	for (int deslocamento = 16; deslocamento >= 0; deslocamento -= 8) {
+		double c0 = (cores[0] >> deslocamento) & 0xFF;
+		double c1 = (double) ((cores[1] >> deslocamento) & 0xFF) - c0;
+		double c2 = (double) ((cores[2] >> deslocamento) & 0xFF) - c0;
+		double dx = 0;
+		double dy = 0;
+
+		if (det != 0) {
+			dx = (c1 * y2 - c2 * y1) / det;
+			dy = (c2 * x1 - c1 * x2) / det;
+		}
+
+		// Avaliado no centro do pixel (x + 0.5, y + 0.5)
+		double base = c0 + dx * (0.5 - x[0]) + dy * (0.5 - y[0]);
+
+		if (!std::isfinite(base) || !std::isfinite(dx) || !std::isfinite(dy)) {
+			base = c0;
+			dx = 0;
+			dy = 0;
+		}
+
+		this->gradientesCores.append(base);
+		this->gradientesCores.append(dx);
+		this->gradientesCores.append(dy);
+	}
+}
+
+void Renderizador::distribuirTriangulos() {
+	Desempenho::Cronometro cronometro(Desempenho::DISTRIBUICAO);
+
+	for (std::vector<unsigned int>& tile : this->triangulosPorTile)
+		tile.clear();
+
+	double fatorX = (double) this->largura / 2;
+	double fatorY = (double) this->altura / 2;
+	std::vector<QRect> areas(this->triangulos.size());
+
+	for (int i = 0; i < this->triangulos.size(); i++) {
+		QList<Ponto> pontos = this->triangulos.at(i).getPontos();
+		double minX = (pontos.at(0).getX() + 1) * fatorX;
+		double maxX = minX;
+		double minY = (pontos.at(0).getY() + 1) * fatorY;
+		double maxY = minY;
+		float minZ = pontos.at(0).getZ();
+		float maxZ = minZ;
+
+		for (int j = 1; j < pontos.size(); j++) {
+			double x = (pontos.at(j).getX() + 1) * fatorX;
+			double y = (pontos.at(j).getY() + 1) * fatorY;
+			minX = std::min(minX, x);
+			maxX = std::max(maxX, x);
+			minY = std::min(minY, y);
+			maxY = std::max(maxY, y);
+			minZ = std::min(minZ, (float) pontos.at(j).getZ());
+			maxZ = std::max(maxZ, (float) pontos.at(j).getZ());
+		}
+
+		if (!std::isfinite(minX) || !std::isfinite(maxX)
+				|| !std::isfinite(minY) || !std::isfinite(maxY))
+			continue;
+
+		// Retângulo envolvente em pixels da imagem (y para baixo), com um
+		// pixel de folga para os arredondamentos dos rasterizadores
+		int xIni = std::max(0.0, floor(minX) - 1);
+		int xFim = std::min(this->largura - 1.0, ceil(maxX) + 1);
+		int yIni = std::max(0.0, floor(this->altura - maxY) - 1);
+		int yFim = std::min(this->altura - 1.0, ceil(this->altura - minY) + 1);
+
+		if (xIni > xFim || yIni > yFim)
+			continue;
+
+		areas[i] = QRect(xIni, yIni, xFim - xIni + 1, yFim - yIni + 1);
+
+		// Limites do bloco e do objeto para a ordenação e o teste de oclusão
+		unsigned int bloco = this->blocosTriangulos.at(i);
+		GrupoTriangulos* grupos[2] = { &this->blocosFacetas[bloco],
+				&this->objetosRenderizados[this->objetosBlocos.at(bloco)] };
+
+		for (GrupoTriangulos* grupo : grupos) {
+			grupo->area = grupo->area.united(areas[i]);
+			grupo->profundidadeMinima = std::min(grupo->profundidadeMinima,
+					minZ);
+			grupo->profundidadeMaxima = std::max(grupo->profundidadeMaxima,
+					maxZ);
+		}
+	}
+
+	// Segmentos: retângulo envolvente dos extremos, em pixels da imagem
+	for (std::vector<unsigned int>& tile : this->segmentosPorTile)
+		tile.clear();
+
+	for (int i = 0; i < this->segmentos.size(); i++) {
+		const Segmento& segmento = this->segmentos.at(i);
+		double x1 = (segmento.inicio.getX() + 1) * fatorX;
+		double x2 = (segmento.fim.getX() + 1) * fatorX;
+		double y1 = this->altura - (segmento.inicio.getY() + 1) * fatorY;
+		double y2 = this->altura - (segmento.fim.getY() + 1) * fatorY;
+
+		if (!std::isfinite(x1) || !std::isfinite(x2) || !std::isfinite(y1)
+				|| !std::isfinite(y2))
+			continue;
+
+		int xIni = std::max(0.0, floor(std::min(x1, x2)));
+		int xFim = std::min(this->largura - 1.0, floor(std::max(x1, x2)));
+		int yIni = std::max(0.0, floor(std::min(y1, y2)));
+		int yFim = std::min(this->altura - 1.0, floor(std::max(y1, y2)));
+
+		for (int tY = yIni / TAMANHO_TILE; tY <= yFim / TAMANHO_TILE; tY++)
+			for (int tX = xIni / TAMANHO_TILE; tX <= xFim / TAMANHO_TILE; tX++)
+				this->segmentosPorTile[tY * this->tilesX + tX].push_back(i);
+	}
+
+	std::vector<unsigned int> ordem;
+	this->ordenarBlocos(&ordem);
+
+	for (unsigned int bloco : ordem) {
+		const GrupoTriangulos& grupo = this->blocosFacetas.at(bloco);
+
+		for (unsigned int i = grupo.inicio; i < grupo.fim; i++) {
+			const QRect& area = areas[i];
+
+			if (area.isEmpty())
+				continue;
+
+			for (int tY = area.top() / TAMANHO_TILE;
+					tY <= area.bottom() / TAMANHO_TILE; tY++)
+				for (int tX = area.left() / TAMANHO_TILE;
+						tX <= area.right() / TAMANHO_TILE; tX++)
+					this->triangulosPorTile[tY * this->tilesX + tX].push_back(
+							i);
+		}
+	}
+}
+
+void Renderizador::ordenarBlocos(std::vector<unsigned int>* ordem) const {
+	unsigned int numObjetos = this->objetosRenderizados.size();
+	unsigned int numBlocos = this->blocosFacetas.size();
+
+	if (this->modoOrdenacao == SUBMISSAO) {
+		ordem->resize(numBlocos);
+		std::iota(ordem->begin(), ordem->end(), 0u);
+		return;
+	}
+
+	std::vector<unsigned long long> chaves(numObjetos);
+	std::vector<unsigned int> ordemObjetos;
+	std::vector<unsigned int> posicaoObjetos(numObjetos);
+
+	for (unsigned int i = 0; i < numObjetos; i++)
+		chaves[i] = this->getChaveProfundidade(this->objetosRenderizados.at(i));
+
+	OrdenacaoRadix::ordenar(chaves, &ordemObjetos);
+
+	for (unsigned int i = 0; i < numObjetos; i++)
+		posicaoObjetos[ordemObjetos[i]] = i;
+
+	// A posição do objeto nos bits altos mantém os blocos de cada objeto
+	// contíguos, ordenados entre si pela própria profundidade
+	chaves.resize(numBlocos);
+
+	for (unsigned int i = 0; i < numBlocos; i++)
+		chaves[i] = ((unsigned long long) posicaoObjetos[this->objetosBlocos.at(
+				i)] << 32) | this->getChaveProfundidade(this->blocosFacetas.at(i));
+
+	OrdenacaoRadix::ordenar(chaves, ordem);
+}
+
+unsigned int Renderizador::getChaveProfundidade(
+		const GrupoTriangulos& grupo) const {
+	// De trás para frente o grupo é ordenado pelo seu ponto mais distante
+	if (this->modoOrdenacao == TRAS_PARA_FRENTE)
+		return ~OrdenacaoRadix::converterProfundidade(grupo.profundidadeMaxima);
+
+	return OrdenacaoRadix::converterProfundidade(grupo.profundidadeMinima);
+}
+
+bool Renderizador::isOculto(const GrupoTriangulos& grupo,
+		const QRect& area) const {
+	QRect regiao = grupo.area.intersected(area);
+
+	return !regiao.isEmpty()
+			&& grupo.profundidadeMinima
+					> this->frameBuffer->getProfundidadeMaxima(regiao);
+}
+
+void Renderizador::rasterizarTile(const unsigned int tile) {
+	QRect area = this->getAreaTile(tile);
+	this->frameBuffer->limpar(area);
+
+	// No sombreamento de Gouraud o G-buffer identifica o triângulo, cujo
+	// gradiente de cores é interpolado na iluminação
+	bool porTriangulo = this->modoSombreamento == GOURAUD;
+	const float* normais = this->normaisFacetas.constData();
+	unsigned int blocoAtual = this->blocosFacetas.size();
+	unsigned int objetoAtual = this->objetosRenderizados.size();
+	bool objetoOculto = false;
+	bool objetoProfundidade = false;
+	bool blocoOculto = false;
+	bool alterado = false;
+	QRect areaBloco;
+	unsigned int ocultos = 0;
+
+	for (unsigned int i : this->triangulosPorTile[tile]) {
+		unsigned int bloco = this->blocosTriangulos.at(i);
+
+		// Ao mudar de bloco a hierarquia é atualizada na região do anterior
+		// e o novo bloco (e o seu objeto, uma única vez) é testado contra ela
+		if (bloco != blocoAtual) {
+			if (alterado)
+				this->frameBuffer->atualizarHierarquia(areaBloco);
+
+			unsigned int objeto = this->objetosBlocos.at(bloco);
+
+			if (objeto != objetoAtual) {
+				objetoAtual = objeto;
+				objetoOculto = this->isOculto(
+						this->objetosRenderizados.at(objeto), area);
+				objetoProfundidade = this->objetosRenderizados.at(objeto)
+						.somenteProfundidade;
+			}
+
+			blocoAtual = bloco;
+			blocoOculto = objetoOculto
+					|| this->isOculto(this->blocosFacetas.at(bloco), area);
+			areaBloco = this->blocosFacetas.at(bloco).area.intersected(area);
+			alterado = false;
+		}
+
+		if (blocoOculto) {
+			ocultos++;
+			continue;
+		}
+
+		unsigned int faceta = this->facetasTriangulos.at(i);
+		const float* n = normais + 3 * faceta;
+		unsigned int identificador = porTriangulo ? i : faceta;
+
+		if (objetoProfundidade)
+			identificador = FrameBuffer::NENHUMA_FACETA;
+
+		this->rasterizador->rasterizarTriangulo(this->triangulos.at(i),
+				identificador, n[0], n[1], n[2], this->frameBuffer, area);
+		alterado = true;
+	}
+
+	this->triangulosOcultosPorTile[tile] = ocultos;
+
+	// Linhas depois dos triângulos, pelo mesmo teste de profundidade e
+	// limitadas à área de clipping (as arestas dos modos aramados não são
+	// recortadas); no sombreamento de Gouraud seus gradientes seguem os dos
+	// triângulos
+	unsigned int numTriangulos = this->triangulos.size();
+	QRect areaLinhas = area.intersected(this->areaClipping);
+
+	if (areaLinhas.isEmpty())
+		return;
+
+	for (unsigned int i : this->segmentosPorTile[tile]) {
+		const Segmento& s = this->segmentos.at(i);
+		unsigned int faceta = porTriangulo ? numTriangulos + s.linha : s.faceta;
+
+		if (s.inicio == s.fim && !s.continuacao)
+			this->rasterizador->rasterizarPonto(s.inicio, faceta, 0, 0, -1,
+					this->frameBuffer, areaLinhas);
+		else
+			this->rasterizador->rasterizarReta(s.inicio, s.fim, faceta, 0, 0,
+					-1, this->frameBuffer, areaLinhas, s.continuacao);
+	}
+}
+
+void Renderizador::iluminarFaixa(const unsigned int faixa, uchar* const bits,
+		const int bytesPorLinha) {
+	unsigned int inicio = faixa * ALTURA_FAIXA;
+	unsigned int fim = std::min(inicio + ALTURA_FAIXA, this->altura);
+	const unsigned int* facetas = this->frameBuffer->getPlanoFacetas();
+	const float* profundidade = this->frameBuffer->getPlanoProfundidade();
+	signed char *normalX, *normalY, *normalZ;
+	this->frameBuffer->getPlanosNormais(&normalX, &normalY, &normalZ);
+	const float* gradientes = this->gradientesCores.constData();
+	std::vector<QRgb> albedos(this->largura);
+
+	for (unsigned int y = inicio; y < fim; y++) {
+		QRgb* linha = (QRgb*) (bits + y * bytesPorLinha);
+		unsigned int i = y * this->largura;
+		unsigned int x = 0;
+
+		while (x < this->largura) {
+			if (facetas[i + x] == FrameBuffer::NENHUMA_FACETA) {
+				linha[x] = this->corFundo;
+				x++;
+				continue;
+			}
+
+			unsigned int xInicio = x;
+
+			while (x < this->largura
+					&& facetas[i + x] != FrameBuffer::NENHUMA_FACETA)
+				x++;
+
+			switch (this->modoSombreamento) {
+			case FLAT:
+				for (unsigned int k = xInicio; k < x; k++)
+					linha[k] = this->coresIluminadas.at(facetas[i + k]);
+				break;
+			case GOURAUD:
+				for (unsigned int k = xInicio; k < x; k++) {
+					const float* g = gradientes + 9 * facetas[i + k];
+					int canais[3];
+
+					for (int c = 0; c < 3; c++, g += 3) {
+						float v = g[0] + g[1] * k + g[2] * y;
+						canais[c] = v <= 0 ? 0 : v >= 255 ? 255 : (int) (v + 0.5f);
+					}
+
+					linha[k] = qRgb(canais[0], canais[1], canais[2]);
+				}
+				break;
+			case PHONG:
+				for (unsigned int k = xInicio; k < x; k++)
+					albedos[k] = this->coresFacetas.at(facetas[i + k]);
+
+				unsigned int j = i + xInicio;
+				this->iluminador->iluminarSequencia(xInicio, y, x - xInicio,
+						profundidade + j, normalX + j, normalY + j, normalZ + j,
+						&albedos[xInicio], linha + xInicio);
+				break;
+			}
+		}
+	}
+}
+
+QRect Renderizador::getAreaTile(const unsigned int tile) const {
+	int x = (tile % this->tilesX) * TAMANHO_TILE;
+	int y = (tile / this->tilesX) * TAMANHO_TILE;
+
+	return QRect(x, y, std::min(TAMANHO_TILE, (int) this->largura - x),
+			std::min(TAMANHO_TILE, (int) this->altura - y));
+}
@@ -1,128 +1,105 @@
 #include "gui/Viewport.h"
-
-#include <cfloat>
-#include <iostream>
-using namespace std;
+#include "util/Desempenho.h"
 
 Viewport::Viewport(QGraphicsView* const janelaGrafica,
 		const unsigned int largura, const unsigned int altura) {
 	this->janelaGrafica = janelaGrafica;
 	this->largura = largura;
 	this->altura = altura;
-	this->clipping = 0;
-	this->rasterizador = new Rasterizador(this->largura, this->altura);
-	this->iluminador = new Iluminador(this->largura, this->altura);
-	this->setAlgoritmoClippingLinhas(Clipping::COHEN_SUTHERLAND);
-	this->matrizPixels = new Pixel*[this->largura];
-	for (unsigned int i = 0; i < this->largura; i++) {
-		this->matrizPixels[i] = new Pixel[this->altura];
-	}
-
-	// Área de clipping
-	QGraphicsScene* scene = this->janelaGrafica->scene();
-
-	if (scene)
-		delete scene;
-
-	scene = new QGraphicsScene(0, 0, this->largura - 5, this->altura - 5,
+	this->renderizador = new Renderizador(this->largura, this->altura,
+			MARGEM_CLIPPING);
+
+	// Cena persistente: uma única imagem com o framebuffer e a área de clipping por cima
+	QGraphicsScene* sceneAnterior = this->janelaGrafica->scene();
+
+	if (sceneAnterior)
+		delete sceneAnterior;
+
+	this->scene = new QGraphicsScene(0, 0, this->largura - 5, this->altura - 5,
 			this->janelaGrafica);
-	this->desenharAreaClipping(scene);
-	this->janelaGrafica->setScene(scene);
+	this->imagem = QImage(this->largura, this->altura, QImage::Format_ARGB32);
+	this->imagem.fill(QColor(255, 255, 255));
+	this->itemImagem = this->scene->addPixmap(QPixmap::fromImage(this->imagem));
+	this->itemImagem->setZValue(0);
+	this->desenharAreaClipping(this->scene);
+
+	// Painel de desempenho, oculto até ser habilitado
+	this->fundoDesempenho = this->scene->addRect(QRectF(),
+			QPen(Qt::NoPen), QBrush(QColor(0, 0, 0, 160)));
+	this->fundoDesempenho->setZValue(2);
+	this->fundoDesempenho->setVisible(false);
+	this->itemDesempenho = this->scene->addSimpleText("",
+			QFont("Monospace", 8));
+	this->itemDesempenho->setBrush(QBrush(QColor(255, 255, 255)));
+	this->itemDesempenho->setPos(MARGEM_CLIPPING + 4, MARGEM_CLIPPING + 4);
+	this->itemDesempenho->setZValue(3);
+	this->itemDesempenho->setVisible(false);
+	this->janelaGrafica->setScene(this->scene);
 }
 
 Viewport::~Viewport() {
-	if (this->clipping)
-		delete this->clipping;
+	if (this->renderizador)
+		delete this->renderizador;
+}
 
-	if (this->rasterizador)
-		delete this->rasterizador;
+void Viewport::atualizarCena(const QList<ObjetoGeometrico*>& objetos) {
+	this->renderizador->renderizar(objetos, &this->imagem);
 
-	if (this->iluminador)
-		delete this->iluminador;
+	Desempenho::Cronometro cronometro(Desempenho::APRESENTACAO);
+	this->itemImagem->setPixmap(QPixmap::fromImage(this->imagem));
+}
 
-	for (unsigned int i = 0; i < this->largura; i++) {
-		delete this->matrizPixels[i];
-	}
-	delete this->matrizPixels;
+void Viewport::setAlgoritmoClippingLinhas(
+		Clipping::AlgoritmoClippingLinha algoritmo) {
+	this->renderizador->setAlgoritmoClippingLinhas(algoritmo);
 }
 
-void Viewport::atualizarCena(const QList<ObjetoGeometrico*>& objetos) {
-	this->reiniciarMatrizPixels();
-	QGraphicsScene* scene = this->janelaGrafica->scene();
+void Viewport::setAlgoritmoRasterizacao(
+		Rasterizador::AlgoritmoRasterizacao algoritmo) {
+	this->renderizador->setAlgoritmoRasterizacao(algoritmo);
+}
 
-	if (scene)
-		delete scene;
+void Viewport::setModoSombreamento(Renderizador::ModoSombreamento modo) {
+	this->renderizador->setModoSombreamento(modo);
+}
 
-	scene = new QGraphicsScene(0, 0, this->largura - 5, this->altura - 5,
-			this->janelaGrafica);
+void Viewport::setDescarteFacesTraseiras(bool descarte) {
+	this->renderizador->setDescarteFacesTraseiras(descarte);
+}
 
-	for (int i = 0; i < objetos.size(); i++) {
-		ObjetoGeometrico* objeto = objetos.at(i)->clonar();
-		ObjetoGeometrico* objetoRecortado = this->clipping->clip(objeto);
-
-		// Objeto está fora da window
-		if (objetoRecortado == 0) {
-			delete objeto;
-			continue;
-		}
-		QList<Pixel> pixels;
-		if (objetoRecortado->getTipo() == ObjetoGeometrico::OBJETO3D) {
-			QList<Faceta> facetas = ((Objeto3D*) objetoRecortado)->getFacetas();
-			for (Faceta f : facetas) {
-				QList<Ponto> pontos = f.getPontos();
-				Poligono p("", pontos, f.getCor());
-				pixels.append(this->rasterizador->rasterizarObjeto(&p));
-			}
-
-		} else {
-			pixels = this->rasterizador->rasterizarObjeto(objetoRecortado);
-		}
-		for (Pixel px : pixels) {
-			/*px = iluminador->iluminarPixel(px);
-			QPen pen(px.getCor());
-			scene->addLine(px.getX(), px.getY(), px.getX(), px.getY(), pen);*/
-			int x = px.getX();
-			int y = px.getY();
-			int z = px.getZ();
-			if (this->matrizPixels[x][y].getZ() > z) {
-				this->matrizPixels[x][y] = px;
-			}
-		}
-
-		delete objetoRecortado;
-
-		if (objetoRecortado != objeto)
-			delete objeto;
-	}
-
-	this->desenharCena(scene);
-	this->desenharAreaClipping(scene);
-	this->janelaGrafica->setScene(scene);
-	this->janelaGrafica->repaint();
+void Viewport::setModoOrdenacao(Renderizador::ModoOrdenacao modo) {
+	this->renderizador->setModoOrdenacao(modo);
 }
 
-void Viewport::setAlgoritmoClippingLinhas(
-		Clipping::AlgoritmoClippingLinha algoritmo) {
-	if (this->clipping)
-		delete this->clipping;
+void Viewport::setModoPreenchimento(Renderizador::ModoPreenchimento modo) {
+	this->renderizador->setModoPreenchimento(modo);
+}
+
+unsigned int Viewport::getNumFacetas() const {
+	return this->renderizador->getNumFacetas();
+}
+
+unsigned int Viewport::getNumFacetasDescartadas() const {
+	return this->renderizador->getNumFacetasDescartadas();
+}
+
+unsigned int Viewport::getNumTriangulosOcultos() const {
+	return this->renderizador->getNumTriangulosOcultos();
+}
 
-	double larguraD = (double) this->largura;
-	double alturaD = (double) this->altura;
+double Viewport::getTaxaRejeicaoProfundidade() const {
+	return this->renderizador->getTaxaRejeicaoProfundidade();
+}
 
-	double xvMin = 2 * MARGEM_CLIPPING / larguraD - 1;
-	double xvMax = 2 * (larguraD - MARGEM_CLIPPING) / larguraD - 1;
-	double yvMin = 2 * MARGEM_CLIPPING / alturaD - 1;
-	double yvMax = 2 * (alturaD - MARGEM_CLIPPING - 1) / alturaD - 1;
+void Viewport::setTextoDesempenho(const QString& texto) {
+	this->itemDesempenho->setText(texto);
+	this->fundoDesempenho->setRect(
+			this->itemDesempenho->sceneBoundingRect().adjusted(-4, -4, 4, 4));
+}
 
-	switch (algoritmo) {
-	case Clipping::COHEN_SUTHERLAND:
-		this->clipping = new ClippingCohenSutherland(xvMin, xvMax, yvMin,
-				yvMax);
-		break;
-	case Clipping::LIANG_BARSKY:
-		this->clipping = new ClippingLiangBarsky(xvMin, xvMax, yvMin, yvMax);
-		break;
-	}
+void Viewport::setPainelDesempenhoVisivel(bool visivel) {
+	this->fundoDesempenho->setVisible(visivel);
+	this->itemDesempenho->setVisible(visivel);
 }
 
 QList<Ponto> Viewport::getPontos() const {
@@ -141,30 +118,6 @@ QList<Ponto> Viewport::getPontos() const {
 	return pontos;
 }
 
-void Viewport::reiniciarMatrizPixels() {
-	Pixel px = Pixel();
-	for (unsigned int x = 0; x < this->largura; x++) {
-		for (unsigned int y = 0; y < this->altura; y++) {
-			this->matrizPixels[x][y] = px;
-		}
-	}
-}
-
-void Viewport::desenharCena(QGraphicsScene * const scene) {
-	for (unsigned int x = 0; x < this->largura; x++) {
-		for (unsigned int y = 0; y < this->altura; y++) {
-			Pixel px = this->matrizPixels[x][y];
-			px = iluminador->iluminarPixel(px);
-			cout << "iluminou" << x << "," << y << endl;
-			QPen pen(px.getCor());
-			scene->addLine(px.getX(), px.getY(), px.getX(), px.getY(), pen);
-			//scene->addEllipse(px.getX(), px.getY(), 1, 1, pen,
-			//		QBrush(px.getCor()));
-			//cout << "pixel:" << px.getX() << "," << px.getY() << endl;
-		}
-	}
-}
-
 void Viewport::desenharAreaClipping(QGraphicsScene* const scene) {
 	QPen pen(QColor(255, 0, 0));
 	QLineF linha1 = QLineF(MARGEM_CLIPPING, MARGEM_CLIPPING,
@@ -176,8 +129,9 @@ void Viewport::desenharAreaClipping(QGraphicsScene* const scene) {
 	QLineF linha4 = QLineF(MARGEM_CLIPPING, this->altura - MARGEM_CLIPPING,
 			this->largura - MARGEM_CLIPPING, this->altura - MARGEM_CLIPPING);
 
-	scene->addLine(linha1, pen);
-	scene->addLine(linha2, pen);
-	scene->addLine(linha3, pen);
-	scene->addLine(linha4, pen);
+	// Desenhada sobre a imagem da cena
+	scene->addLine(linha1, pen)->setZValue(1);
+	scene->addLine(linha2, pen)->setZValue(1);
+	scene->addLine(linha3, pen)->setZValue(1);
+	scene->addLine(linha4, pen)->setZValue(1);
 }
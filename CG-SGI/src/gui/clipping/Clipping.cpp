@@ -1,5 +1,7 @@
 #include "gui/clipping/Clipping.h"
 
+#include <cmath>
+
 Clipping::Clipping(const double xvMin, const double xvMax, const double yvMin,
 		const double yvMax) {
 	this->xvMin = xvMin;
@@ -30,9 +32,8 @@ ObjetoGeometrico* Clipping::clip(ObjetoGeometrico* const objeto) const {
 }
 
 ObjetoGeometrico* Clipping::clipObjeto3D(Objeto3D* const objeto) const {
-	Objeto3D* novoObjeto = (Objeto3D*) objeto->clonar();
-
-	return novoObjeto; // TODO Fazer novo clipping;
+	// Sem recorte, o próprio objeto é devolvido em vez de uma cópia
+	return objeto; // TODO Fazer novo clipping;
 }
 
 ObjetoGeometrico* Clipping::clipCurva(const Curva* const curva) const {
@@ -68,6 +69,15 @@ ObjetoGeometrico* Clipping::clipPoligono(const Poligono* const poligono) const {
 	QList<Ponto> pontosPoligono = poligono->getPontos();
 	QList<Ponto> novosPontos;
 	QList<BordaClipping> bordas = { DIREITA, ESQUERDA, FUNDO, TOPO };
+	bool dentro = true;
+
+	for (const Ponto& p : pontosPoligono)
+		dentro = dentro && p.getX() >= xvMin && p.getX() <= xvMax
+				&& p.getY() >= yvMin && p.getY() <= yvMax;
+
+	// Polígono inteiramente visível mantém a triangulação já calculada
+	if (dentro)
+		return new Poligono(*poligono);
 
 	for (BordaClipping borda : bordas) {
 		for (int i = 0; i < pontosPoligono.size(); i++) {
@@ -103,6 +113,42 @@ ObjetoGeometrico* Clipping::clipPonto(const Ponto* const ponto) const {
 	return 0;
 }
 
+ObjetoGeometrico* Clipping::clipReta(const Reta* const reta) const {
+	QList<Ponto> pontos = reta->getPontos();
+	Ponto p1 = pontos.at(0);
+	Ponto p2 = pontos.at(1);
+	double inicio[3] = { p1.getX(), p1.getY(), p1.getZ() };
+	double fim[3] = { p2.getX(), p2.getY(), p2.getZ() };
+
+	if (!this->clipSegmento(inicio, fim))
+		return 0;
+
+	p1.setX(inicio[0]);
+	p1.setY(inicio[1]);
+	p1.setZ(inicio[2]);
+	p2.setX(fim[0]);
+	p2.setY(fim[1]);
+	p2.setZ(fim[2]);
+
+	return new Reta(reta->getNome(), p1, p2, reta->getCor());
+}
+
+void Clipping::interpolarProfundidade(const double inicio[3],
+		const double fim[3], double* const p) const {
+	double dX = fim[0] - inicio[0];
+	double dY = fim[1] - inicio[1];
+
+	// Parâmetro medido no eixo de maior variação, o mais estável
+	double t = 0;
+
+	if (std::abs(dX) >= std::abs(dY) && dX != 0)
+		t = (p[0] - inicio[0]) / dX;
+	else if (dY != 0)
+		t = (p[1] - inicio[1]) / dY;
+
+	p[2] = inicio[2] + t * (fim[2] - inicio[2]);
+}
+
 bool Clipping::clipPontosPorBorda(Ponto* const p1, Ponto* const p2,
 		BordaClipping borda) const {
 	Reta reta("", *p1, *p2);
@@ -8,35 +8,35 @@ ClippingCohenSutherland::ClippingCohenSutherland(const double xvMin,
 ClippingCohenSutherland::~ClippingCohenSutherland() {
 }
 
-ObjetoGeometrico* ClippingCohenSutherland::clipReta(const Reta* const reta) const {
-	QList<Ponto> pontos = reta->getPontos();
-	Ponto p1 = pontos.at(0);
-	Ponto p2 = pontos.at(1);
+bool ClippingCohenSutherland::clipSegmento(double* const p1,
+		double* const p2) const {
+	const double inicio[3] = { p1[0], p1[1], p1[2] };
+	const double fim[3] = { p2[0], p2[1], p2[2] };
 
 	// Region Code = Topo [0] Fundo [1] Direita [2] Esquerda [3]
 	short rc1[4] = {0, 0, 0, 0};
 	short rc2[4] = {0, 0, 0, 0};
-	this->carregarRcPonto(&p1, rc1);
-	this->carregarRcPonto(&p2, rc2);
+	this->carregarRcPonto(p1, rc1);
+	this->carregarRcPonto(p2, rc2);
 
 	if ((rc1[0] * rc2[0] + rc1[1] * rc2[1] + rc1[2] * rc2[2] + rc1[3] * rc2[3])
 			!= 0)
-		return 0;
+		return false;
 
 	if ((rc1[0] + rc2[0] + rc1[1] + rc2[1] + rc1[2] + rc2[2] + rc1[3] + rc2[3])
 			== 0)
-		return new Reta(*reta);
+		return true;
 
-	double coefAngular = reta->coeficienteAngular();
+	double coefAngular = (fim[1] - inicio[1]) / (fim[0] - inicio[0]);
 
 	switch (rc1[0] + rc1[1] + rc1[2] + rc1[3]) {
 		case 1:
-			if (!this->clippingBasico(rc1, &p1, coefAngular))
-				return 0;
+			if (!this->clippingBasico(rc1, p1, coefAngular))
+				return false;
 			break;
 		case 2:
-			if (!this->clippingComposto(rc1, &p1, coefAngular))
-				return 0;
+			if (!this->clippingComposto(rc1, p1, coefAngular))
+				return false;
 			break;
 		default:
 			break;
@@ -44,32 +44,36 @@ ObjetoGeometrico* ClippingCohenSutherland::clipReta(const Reta* const reta) cons
 
 	switch (rc2[0] + rc2[1] + rc2[2] + rc2[3]) {
 		case 1:
-			this->clippingBasico(rc2, &p2, coefAngular);
+			this->clippingBasico(rc2, p2, coefAngular);
 			break;
 		case 2:
-			this->clippingComposto(rc2, &p2, coefAngular);
+			this->clippingComposto(rc2, p2, coefAngular);
 			break;
 		default:
 			break;
 	}
 
-	return new Reta(reta->getNome(), p1, p2, reta->getCor());
+	// Extremos recortados recebem a profundidade interpolada na reta
+	this->interpolarProfundidade(inicio, fim, p1);
+	this->interpolarProfundidade(inicio, fim, p2);
+
+	return true;
 }
 
-void ClippingCohenSutherland::carregarRcPonto(const Ponto* const p, short rc[4]) const {
-	if (p->getY() > yvMax) {
+void ClippingCohenSutherland::carregarRcPonto(const double* const p, short rc[4]) const {
+	if (p[1] > yvMax) {
 		rc[0] = 1;
-	} else if (p->getY() < yvMin) {
+	} else if (p[1] < yvMin) {
 		rc[1] = 1;
 	}
-	if (p->getX() > xvMax) {
+	if (p[0] > xvMax) {
 		rc[2] = 1;
-	} else if (p->getX() < xvMin) {
+	} else if (p[0] < xvMin) {
 		rc[3] = 1;
 	}
 }
 
-bool ClippingCohenSutherland::clippingBasico(short *rc, Ponto* const p,
+bool ClippingCohenSutherland::clippingBasico(short *rc, double* const p,
 		const double coefAngular) const {
 	if (rc[0]) {
 		return this->clippingTopo(p, coefAngular);
@@ -85,7 +89,7 @@ bool ClippingCohenSutherland::clippingBasico(short *rc, Ponto* const p,
 	return true;
 }
 
-bool ClippingCohenSutherland::clippingComposto(short *rc, Ponto* const p,
+bool ClippingCohenSutherland::clippingComposto(short *rc, double* const p,
 		const double coefAngular) const {
 	bool continua = true;
 	if (rc[0]) {
@@ -101,42 +105,42 @@ bool ClippingCohenSutherland::clippingComposto(short *rc, Ponto* const p,
 	return true;
 }
 
-bool ClippingCohenSutherland::clippingDireita(Ponto* const p,
+bool ClippingCohenSutherland::clippingDireita(double* const p,
 		const double coefAngular) const {
-	double y = coefAngular * (xvMax - p->getX()) + p->getY();
+	double y = coefAngular * (xvMax - p[0]) + p[1];
 	if (y < yvMin || y > yvMax)
 		return false;
-	p->setX(xvMax);
-	p->setY(y);
+	p[0] = xvMax;
+	p[1] = y;
 	return true;
 }
 
-bool ClippingCohenSutherland::clippingEsquerda(Ponto* const p,
+bool ClippingCohenSutherland::clippingEsquerda(double* const p,
 		const double coefAngular) const {
-	double y = coefAngular * (xvMin - p->getX()) + p->getY();
+	double y = coefAngular * (xvMin - p[0]) + p[1];
 	if (y < yvMin || y > yvMax)
 		return false;
-	p->setX(xvMin);
-	p->setY(y);
+	p[0] = xvMin;
+	p[1] = y;
 	return true;
 }
 
-bool ClippingCohenSutherland::clippingFundo(Ponto* const p,
+bool ClippingCohenSutherland::clippingFundo(double* const p,
 		const double coefAngular) const {
-	double x = p->getX() + (yvMin - p->getY()) / coefAngular;
+	double x = p[0] + (yvMin - p[1]) / coefAngular;
 	if (x < xvMin || x > xvMax)
 		return false;
-	p->setX(x);
-	p->setY(yvMin);
+	p[0] = x;
+	p[1] = yvMin;
 	return true;
 }
 
-bool ClippingCohenSutherland::clippingTopo(Ponto* const p,
+bool ClippingCohenSutherland::clippingTopo(double* const p,
 		const double coefAngular) const {
-	double x = p->getX() + (yvMax - p->getY()) / coefAngular;
+	double x = p[0] + (yvMax - p[1]) / coefAngular;
 	if (x < xvMin || x > xvMax)
 		return false;
-	p->setX(x);
-	p->setY(yvMax);
+	p[0] = x;
+	p[1] = yvMax;
 	return true;
 }
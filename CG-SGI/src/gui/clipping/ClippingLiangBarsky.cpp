@@ -8,15 +8,14 @@ ClippingLiangBarsky::ClippingLiangBarsky(const double xvMin, const double xvMax,
 ClippingLiangBarsky::~ClippingLiangBarsky() {
 }
 
-ObjetoGeometrico* ClippingLiangBarsky::clipReta(const Reta* const reta) const {
-	QList<Ponto> pontos = reta->getPontos();
-	Ponto p1 = pontos.at(0);
-	Ponto p2 = pontos.at(1);
-
-	double x1 = p1.getX();
-	double y1 = p1.getY();
-	double dX = p2.getX() - p1.getX();
-	double dY = p2.getY() - p1.getY();
+bool ClippingLiangBarsky::clipSegmento(double* const p1,
+		double* const p2) const {
+	double x1 = p1[0];
+	double y1 = p1[1];
+	double dX = p2[0] - p1[0];
+	double dY = p2[1] - p1[1];
+	double z1 = p1[2];
+	double dZ = p2[2] - p1[2];
 
 	double p[4] = { -dX, dX, -dY, dY };
 	double q[4] = { x1 - xvMin,
@@ -28,23 +27,26 @@ ObjetoGeometrico* ClippingLiangBarsky::clipReta(const Reta* const reta) const {
 	double csi2 = this->csi2(p, q);
 
 	if (csi1 > csi2) // Reta está fora da viewport
-		return 0;
+		return false;
+
+	// Reta paralela a uma borda, do lado de fora
+	for (int i = 0; i < 4; i++)
+		if (p[i] == 0 && q[i] < 0)
+			return false;
 
 	if (csi1 != 0) {
-		double x = x1 + csi1 * p[1];
-		double y = y1 + csi1 * p[3];
-		p1.setX(x);
-		p1.setY(y);
+		p1[0] = x1 + csi1 * p[1];
+		p1[1] = y1 + csi1 * p[3];
+		p1[2] = z1 + csi1 * dZ;
 	}
 
 	if (csi2 != 1) {
-		double x = x1 + csi2 * p[1];
-		double y = y1 + csi2 * p[3];
-		p2.setX(x);
-		p2.setY(y);
+		p2[0] = x1 + csi2 * p[1];
+		p2[1] = y1 + csi2 * p[3];
+		p2[2] = z1 + csi2 * dZ;
 	}
 
-	return new Reta(reta->getNome(), p1, p2, reta->getCor());
+	return true;
 }
 
 double ClippingLiangBarsky::csi1(double *p, double *q) const {
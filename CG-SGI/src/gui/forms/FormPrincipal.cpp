@@ -1,5 +1,8 @@
 #include "gui/forms/FormPrincipal.h"
 #include "persistencia/ArquivoOBJ.h"
+#include "util/Desempenho.h"
+#include "util/Log.h"
+#include "util/Rastreamento.h"
 
 FormPrincipal::FormPrincipal(ControladorUI* controladorUI, QDialog* pai,
 		Qt::WindowFlags flags) :
@@ -12,6 +15,7 @@ FormPrincipal::FormPrincipal(ControladorUI* controladorUI, QDialog* pai,
 	this->valorRotacaoX = this->dialBtnRotacao->value();
 	this->valorRotacaoY = this->dialBtnRotacao->value();
 	this->valorRotacaoZ = this->dialBtnRotacao->value();
+	this->painelDesempenho = false;
 	this->controladorUI = controladorUI;
 	this->viewport = new Viewport(this->graphicsView, 475, 555);
 }
@@ -32,24 +36,41 @@ ControladorUI* FormPrincipal::getControladorUI() {
 }
 
 void FormPrincipal::atualizarCena(const QList<ObjetoGeometrico*>& objetos) {
-	// Remover todos os objetos da tabela
-	while (this->displayFile->rowCount() > 0)
-		this->displayFile->removeRow(0);
-
-	// Inserir todos os objetos atualizados na tabela
-	for (ObjetoGeometrico* obj : objetos) {
-		this->displayFile->insertRow(this->displayFile->rowCount());
-		QTableWidgetItem* tipo = new QTableWidgetItem(
-				QString::fromStdString(obj->getTipoString()));
-		QTableWidgetItem* nome = new QTableWidgetItem(
-				QString::fromStdString(obj->getNome()));
-		this->displayFile->setItem(this->displayFile->rowCount() - 1, 0,
-				tipo);
-		this->displayFile->setItem(this->displayFile->rowCount() - 1, 1,
-				nome);
+	{
+		Desempenho::Cronometro cronometro(Desempenho::APRESENTACAO);
+
+		// Remover todos os objetos da tabela
+		while (this->displayFile->rowCount() > 0)
+			this->displayFile->removeRow(0);
+
+		// Inserir todos os objetos atualizados na tabela
+		for (ObjetoGeometrico* obj : objetos) {
+			this->displayFile->insertRow(this->displayFile->rowCount());
+			QTableWidgetItem* tipo = new QTableWidgetItem(
+					QString::fromStdString(obj->getTipoString()));
+			QTableWidgetItem* nome = new QTableWidgetItem(
+					QString::fromStdString(obj->getNome()));
+			this->displayFile->setItem(this->displayFile->rowCount() - 1, 0,
+					tipo);
+			this->displayFile->setItem(this->displayFile->rowCount() - 1, 1,
+					nome);
+		}
 	}
 
 	this->viewport->atualizarCena(objetos);
+	Desempenho::finalizarQuadro();
+
+	if (this->painelDesempenho)
+		this->atualizarPainelDesempenho();
+
+	this->statusBar()->showMessage(
+			QString("Facetas: %1, descartadas: %2, triângulos ocultos: %3, "
+					"rejeição de profundidade: %4%").arg(
+					this->viewport->getNumFacetas()).arg(
+					this->viewport->getNumFacetasDescartadas()).arg(
+					this->viewport->getNumTriangulosOcultos()).arg(
+					this->viewport->getTaxaRejeicaoProfundidade() * 100, 0,
+					'f', 1));
 }
 
 void FormPrincipal::conectarSinaisSlots() {
@@ -108,6 +129,74 @@ void FormPrincipal::inicializarMenu() {
 	QAction* itemSair = menuArquivo->addAction("&Sair");
 	itemSair->setShortcut(QKeySequence("CTRL+SHIFT+S", QKeySequence::NativeText));
 
+	QMenu* menuRenderizacao = menuBar()->addMenu("&Renderização");
+	QMenu* menuRasterizacao = menuRenderizacao->addMenu("&Rasterização");
+	QActionGroup* grupoRasterizacao = new QActionGroup(menuRasterizacao);
+	QAction* itemScanline = grupoRasterizacao->addAction("&Scanline");
+	itemScanline->setData(Rasterizador::SCANLINE);
+	itemScanline->setCheckable(true);
+	itemScanline->setChecked(true);
+	QAction* itemSemiPlano = grupoRasterizacao->addAction("Semi-&planos (blocos 8x8)");
+	itemSemiPlano->setData(Rasterizador::SEMI_PLANO);
+	itemSemiPlano->setCheckable(true);
+	menuRasterizacao->addActions(grupoRasterizacao->actions());
+	QMenu* menuSombreamento = menuRenderizacao->addMenu("&Sombreamento");
+	QActionGroup* grupoSombreamento = new QActionGroup(menuSombreamento);
+	QAction* itemFlat = grupoSombreamento->addAction("&Flat");
+	itemFlat->setData(Renderizador::FLAT);
+	itemFlat->setCheckable(true);
+	QAction* itemGouraud = grupoSombreamento->addAction("&Gouraud");
+	itemGouraud->setData(Renderizador::GOURAUD);
+	itemGouraud->setCheckable(true);
+	QAction* itemPhong = grupoSombreamento->addAction("&Phong");
+	itemPhong->setData(Renderizador::PHONG);
+	itemPhong->setCheckable(true);
+	itemPhong->setChecked(true);
+	menuSombreamento->addActions(grupoSombreamento->actions());
+	QMenu* menuOrdenacao = menuRenderizacao->addMenu("&Ordenação");
+	QActionGroup* grupoOrdenacao = new QActionGroup(menuOrdenacao);
+	QAction* itemSubmissao = grupoOrdenacao->addAction("&Submissão");
+	itemSubmissao->setData(Renderizador::SUBMISSAO);
+	itemSubmissao->setCheckable(true);
+	QAction* itemFrente = grupoOrdenacao->addAction("De &frente para trás");
+	itemFrente->setData(Renderizador::FRENTE_PARA_TRAS);
+	itemFrente->setCheckable(true);
+	itemFrente->setChecked(true);
+	QAction* itemTras = grupoOrdenacao->addAction("De &trás para frente");
+	itemTras->setData(Renderizador::TRAS_PARA_FRENTE);
+	itemTras->setCheckable(true);
+	menuOrdenacao->addActions(grupoOrdenacao->actions());
+	QMenu* menuPreenchimento = menuRenderizacao->addMenu("&Preenchimento");
+	QActionGroup* grupoPreenchimento = new QActionGroup(menuPreenchimento);
+	QAction* itemSolido = grupoPreenchimento->addAction("S&ólido");
+	itemSolido->setData(Renderizador::SOLIDO);
+	itemSolido->setCheckable(true);
+	itemSolido->setChecked(true);
+	itemSolido->setShortcut(QKeySequence("F5", QKeySequence::NativeText));
+	QAction* itemAramado = grupoPreenchimento->addAction("&Aramado");
+	itemAramado->setData(Renderizador::ARAMADO);
+	itemAramado->setCheckable(true);
+	itemAramado->setShortcut(QKeySequence("F6", QKeySequence::NativeText));
+	QAction* itemLinhasOcultas = grupoPreenchimento->addAction("Aramado sem linhas &ocultas");
+	itemLinhasOcultas->setData(Renderizador::LINHAS_OCULTAS);
+	itemLinhasOcultas->setCheckable(true);
+	itemLinhasOcultas->setShortcut(QKeySequence("F7", QKeySequence::NativeText));
+	menuPreenchimento->addActions(grupoPreenchimento->actions());
+	QAction* itemDescarte = menuRenderizacao->addAction("&Descartar faces traseiras");
+	itemDescarte->setCheckable(true);
+	itemDescarte->setChecked(true);
+
+	QMenu* menuDesempenho = menuBar()->addMenu("&Desempenho");
+	QAction* itemPainel = menuDesempenho->addAction("Exibir &painel");
+	itemPainel->setShortcut(QKeySequence("F3", QKeySequence::NativeText));
+	itemPainel->setCheckable(true);
+	QAction* itemExportarDesempenho = menuDesempenho->addAction("&Exportar histórico (CSV)...");
+	menuDesempenho->addSeparator();
+	QAction* itemGravarRastreamento = menuDesempenho->addAction("&Gravar rastreamento");
+	itemGravarRastreamento->setCheckable(true);
+	itemGravarRastreamento->setChecked(Rastreamento::isHabilitado());
+	QAction* itemExportarRastreamento = menuDesempenho->addAction("Exportar &rastreamento (JSON)...");
+
 	QAction* itemAtalhos = menuBar()->addAction("Ata&lhos");
 	QAction* itemSobre = menuBar()->addAction("&Sobre");
 
@@ -119,6 +208,15 @@ void FormPrincipal::inicializarMenu() {
 	QObject::connect(itemSobre, SIGNAL(triggered()), this, SLOT(sobreSistema()));
 	QObject::connect(itemCenaBasicMan, SIGNAL(triggered()), this, SLOT(importarCenaPreDefinida()));
 	QObject::connect(itemCenaCristo, SIGNAL(triggered()), this, SLOT(importarCenaPreDefinida()));
+	QObject::connect(grupoRasterizacao, SIGNAL(triggered(QAction*)), this, SLOT(atualizarAlgoritmoRasterizacao(QAction*)));
+	QObject::connect(grupoSombreamento, SIGNAL(triggered(QAction*)), this, SLOT(atualizarModoSombreamento(QAction*)));
+	QObject::connect(grupoOrdenacao, SIGNAL(triggered(QAction*)), this, SLOT(atualizarModoOrdenacao(QAction*)));
+	QObject::connect(grupoPreenchimento, SIGNAL(triggered(QAction*)), this, SLOT(atualizarModoPreenchimento(QAction*)));
+	QObject::connect(itemDescarte, SIGNAL(toggled(bool)), this, SLOT(atualizarDescarteFacesTraseiras(bool)));
+	QObject::connect(itemPainel, SIGNAL(toggled(bool)), this, SLOT(exibirPainelDesempenho(bool)));
+	QObject::connect(itemExportarDesempenho, SIGNAL(triggered()), this, SLOT(exportarDesempenho()));
+	QObject::connect(itemGravarRastreamento, SIGNAL(toggled(bool)), this, SLOT(gravarRastreamento(bool)));
+	QObject::connect(itemExportarRastreamento, SIGNAL(triggered()), this, SLOT(exportarRastreamento()));
 
 	menuBar()->setVisible(true);
 }
@@ -255,6 +353,7 @@ void FormPrincipal::importarCena() {
 	try {
 		this->controladorUI->importarCena(arquivo);
 	} catch(Excecao& ex) {
+		LOG_ERRO(Log::PERSISTENCIA, "%s", ex.getMensagem().c_str());
 		this->controladorUI->exibirMensagemErro("Não foi possível importar a cena!\n\nDetalhes: " + ex.getMensagem(), this);
 	}
 }
@@ -266,6 +365,7 @@ void FormPrincipal::importarCenaPreDefinida() {
 	try {
 		this->controladorUI->importarCena(cena);
 	} catch(Excecao& ex) {
+		LOG_ERRO(Log::PERSISTENCIA, "%s", ex.getMensagem().c_str());
 		this->controladorUI->exibirMensagemErro("Não foi possível importar a cena!\n\nDetalhes: " + ex.getMensagem(), this);
 	}
 }
@@ -306,7 +406,12 @@ void FormPrincipal::atalhosSistema() {
 				":: Manipulação de Objetos ::\n\n"
 				"ALT + I\t\tInserir Objeto\n"
 				"ALT + R\t\tRemover Objeto\n"
-				"ALT + T\t\tTransformar Objeto";
+				"ALT + T\t\tTransformar Objeto\n\n"
+				":: Renderização ::\n\n"
+				"F5\t\tSólido\n"
+				"F6\t\tAramado\n"
+				"F7\t\tAramado sem linhas ocultas\n"
+				"F3\t\tPainel de desempenho";
 
 	this->controladorUI->exibirMensagemInformacao(atalhos, this);
 }
@@ -352,6 +457,105 @@ void FormPrincipal::atualizarAlgoritmoClipping(bool cohenSutherland) {
 	}
 }
 
+void FormPrincipal::atualizarAlgoritmoRasterizacao(QAction* acao) {
+	this->viewport->setAlgoritmoRasterizacao(
+			(Rasterizador::AlgoritmoRasterizacao) acao->data().toInt());
+	this->controladorUI->redesenharCena();
+}
+
+void FormPrincipal::atualizarModoSombreamento(QAction* acao) {
+	this->viewport->setModoSombreamento(
+			(Renderizador::ModoSombreamento) acao->data().toInt());
+	this->controladorUI->redesenharCena();
+}
+
+void FormPrincipal::atualizarModoOrdenacao(QAction* acao) {
+	this->viewport->setModoOrdenacao(
+			(Renderizador::ModoOrdenacao) acao->data().toInt());
+	this->controladorUI->redesenharCena();
+}
+
+void FormPrincipal::atualizarModoPreenchimento(QAction* acao) {
+	this->viewport->setModoPreenchimento(
+			(Renderizador::ModoPreenchimento) acao->data().toInt());
+	this->controladorUI->redesenharCena();
+}
+
+void FormPrincipal::atualizarDescarteFacesTraseiras(bool descarte) {
+	this->viewport->setDescarteFacesTraseiras(descarte);
+	this->controladorUI->redesenharCena();
+}
+
+void FormPrincipal::exibirPainelDesempenho(bool exibir) {
+	this->painelDesempenho = exibir;
+	this->viewport->setPainelDesempenhoVisivel(exibir);
+
+	if (exibir)
+		this->atualizarPainelDesempenho();
+}
+
+void FormPrincipal::exportarDesempenho() {
+	String arquivo = QFileDialog::getSaveFileName(0,
+			"Salvar histórico de desempenho (CSV)", "", "*.csv").toStdString();
+
+	if (arquivo.compare("") == 0) // Usuário cancelou
+		return;
+
+	if (!Desempenho::exportarCSV(arquivo)) {
+		LOG_ERRO(Log::PERSISTENCIA, "não foi possível gravar %s",
+				arquivo.c_str());
+		this->controladorUI->exibirMensagemErro(
+				"Não foi possível gravar o histórico em " + arquivo + ".",
+				this);
+	}
+}
+
+void FormPrincipal::gravarRastreamento(bool gravar) {
+	Rastreamento::setHabilitado(gravar);
+}
+
+void FormPrincipal::exportarRastreamento() {
+	String arquivo = QFileDialog::getSaveFileName(0,
+			"Salvar rastreamento (Chrome/Perfetto)", "", "*.json").toStdString();
+
+	if (arquivo.compare("") == 0) // Usuário cancelou
+		return;
+
+	if (!Rastreamento::exportar(arquivo)) {
+		LOG_ERRO(Log::PERSISTENCIA, "não foi possível gravar %s",
+				arquivo.c_str());
+		this->controladorUI->exibirMensagemErro(
+				"Não foi possível gravar o rastreamento em " + arquivo + ".",
+				this);
+	}
+}
+
+void FormPrincipal::atualizarPainelDesempenho() {
+	if (Desempenho::getNumQuadros() == 0) {
+		this->viewport->setTextoDesempenho("Nenhum quadro medido");
+		return;
+	}
+
+	Desempenho::Quadro ultimo = Desempenho::getQuadro(0);
+	Desempenho::Quadro media = Desempenho::getMedia(QUADROS_MEDIA);
+	QString texto = QString("Quadro %1: %2 ms (média %3 ms, %4 FPS)\n").arg(
+			ultimo.numero).arg(ultimo.duracao / 1e6, 0, 'f', 2).arg(
+			media.duracao / 1e6, 0, 'f', 2).arg(
+			media.duracao > 0 ? 1e9 / media.duracao : 0, 0, 'f', 1);
+
+	for (int i = 0; i < Desempenho::NUM_ETAPAS; i++)
+		texto += QString("%1 %2 ms\n").arg(
+				Desempenho::getNome((Desempenho::Etapa) i), -13).arg(
+				media.etapas[i] / 1e6, 7, 'f', 2);
+
+	for (int i = 0; i < Desempenho::NUM_CONTADORES; i++)
+		texto += QString("%1 %2\n").arg(
+				Desempenho::getNome((Desempenho::Contador) i), -22).arg(
+				ultimo.contadores[i], 9);
+
+	this->viewport->setTextoDesempenho(texto.trimmed());
+}
+
 void FormPrincipal::atualizarTipoProjecao(bool projecaoParalela) {
 	if(projecaoParalela) {
 		this->controladorUI->setProjetorVisualizacao(Projetor::PARALELA_ORTOGONAL);
@@ -0,0 +1,141 @@
+#include "gui/rasterizacao/Rasterizador.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+Rasterizador::Rasterizador(const AlgoritmoRasterizacao algoritmo,
+		const unsigned int tamX, const unsigned int tamY) {
+	this->algoritmo = algoritmo;
+	this->tamX = tamX;
+	this->tamY = tamY;
+}
+
+Rasterizador::~Rasterizador() {
+}
+
+Rasterizador::AlgoritmoRasterizacao Rasterizador::getAlgoritmo() const {
+	return this->algoritmo;
+}
+
+void Rasterizador::rasterizarPonto(const Ponto& ponto,
+		const unsigned int faceta, const float nX, const float nY,
+		const float nZ, DestinoFragmentos* const destino,
+		const QRect& area) const {
+	int x, y;
+
+	if (this->converterPixel(ponto, &x, &y) && area.contains(x, y))
+		destino->escreverFragmento(x, y, ponto.getZ(), faceta, nX, nY, nZ);
+}
+
+void Rasterizador::rasterizarReta(const Ponto& p1, const Ponto& p2,
+		const unsigned int faceta, const float nX, const float nY,
+		const float nZ, DestinoFragmentos* const destino, const QRect& area,
+		const bool omitirInicio) const {
+	int x1, y1, x2, y2;
+
+	if (!this->converterPixel(p1, &x1, &y1)
+			|| !this->converterPixel(p2, &x2, &y2))
+		return;
+
+	// Eixo maior: um fragmento por passo; eixo menor: avança conforme o erro
+	bool xMaior = std::abs(x2 - x1) >= std::abs(y2 - y1);
+	int maior = xMaior ? x1 : y1;
+	int menor = xMaior ? y1 : x1;
+	long long dMaior = std::abs(xMaior ? x2 - x1 : y2 - y1);
+	long long dMenor = std::abs(xMaior ? y2 - y1 : x2 - x1);
+	int sMaior = (xMaior ? x2 >= x1 : y2 >= y1) ? 1 : -1;
+	int sMenor = (xMaior ? y2 >= y1 : x2 >= x1) ? 1 : -1;
+	int minMaior = xMaior ? area.left() : area.top();
+	int maxMaior = xMaior ? area.right() : area.bottom();
+	int minMenor = xMaior ? area.top() : area.left();
+	int maxMenor = xMaior ? area.bottom() : area.right();
+
+	// Passos cujo eixo maior está dentro da área
+	long long inicio = omitirInicio ? 1 : 0;
+	long long fim = dMaior;
+
+	if (sMaior > 0) {
+		inicio = std::max(inicio, (long long) minMaior - maior);
+		fim = std::min(fim, (long long) maxMaior - maior);
+	} else {
+		inicio = std::max(inicio, (long long) maior - maxMaior);
+		fim = std::min(fim, (long long) maior - minMaior);
+	}
+
+	if (inicio > fim)
+		return;
+
+	double incZ = dMaior == 0 ? 0 : (p2.getZ() - p1.getZ()) / dMaior;
+	double z = p1.getZ() + incZ * inicio;
+
+	// Posição no eixo menor no passo i: menor + sMenor * floor((2 i dMenor
+	// + dMaior) / (2 dMaior)), calculada diretamente no primeiro passo
+	long long dobroMaior = std::max(2 * dMaior, 1LL);
+	long long erro = 2 * inicio * dMenor + dMaior;
+	maior += sMaior * inicio;
+	menor += sMenor * (erro / dobroMaior);
+	erro %= dobroMaior;
+
+	for (long long i = inicio; i <= fim; i++) {
+		if (menor >= minMenor && menor <= maxMenor) {
+			if (xMaior)
+				destino->escreverFragmento(maior, menor, z, faceta, nX, nY, nZ);
+			else
+				destino->escreverFragmento(menor, maior, z, faceta, nX, nY, nZ);
+		}
+
+		maior += sMaior;
+		z += incZ;
+		erro += 2 * dMenor;
+
+		if (erro >= dobroMaior) {
+			erro -= dobroMaior;
+			menor += sMenor;
+		}
+	}
+}
+
+bool Rasterizador::converterPixel(const Ponto& ponto, int* x, int* y) const {
+	double pixelX = (ponto.getX() + 1) * this->tamX / 2;
+	double pixelY = this->tamY - (ponto.getY() + 1) * this->tamY / 2;
+
+	if (!std::isfinite(pixelX) || !std::isfinite(pixelY))
+		return false;
+
+	// Limitar pontos muito distantes (não recortados) ao intervalo de int
+	const double limite = 1 << 28;
+	*x = (int) floor(std::max(-limite, std::min(limite, pixelX)));
+	*y = (int) floor(std::max(-limite, std::min(limite, pixelY)));
+
+	return true;
+}
+
+void Rasterizador::calcularNormal(const Ponto& p1, const Ponto& p2,
+		const Ponto& p3, float* nX, float* nY, float* nZ) const {
+	double x1 = p1.getX() - p2.getX();
+	double y1 = p1.getY() - p2.getY();
+	double z1 = p1.getZ() - p2.getZ();
+	double x2 = p3.getX() - p2.getX();
+	double y2 = p3.getY() - p2.getY();
+	double z2 = p3.getZ() - p2.getZ();
+
+	double xNormal = y1 * z2 - z1 * y2;
+	double yNormal = z1 * x2 - x1 * z2;
+	double zNormal = x1 * y2 - y1 * x2;
+
+	if (zNormal > 0) {
+		xNormal *= -1;
+		yNormal *= -1;
+		zNormal *= -1;
+	}
+
+	double comprimento = sqrt(
+			xNormal * xNormal + yNormal * yNormal + zNormal * zNormal);
+	if (comprimento == 0)
+		comprimento = 1;
+
+	*nX = xNormal / comprimento;
+	*nY = yNormal / comprimento;
+	*nZ = zNormal / comprimento;
+}
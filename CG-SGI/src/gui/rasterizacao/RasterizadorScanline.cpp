@@ -0,0 +1,195 @@
+#include "gui/rasterizacao/RasterizadorScanline.h"
+
+RasterizadorScanline::RasterizadorScanline(const unsigned int tamX,
+		const unsigned int tamY) :
+		Rasterizador(Rasterizador::SCANLINE, tamX, tamY) {
+}
+
+RasterizadorScanline::~RasterizadorScanline() {
+}
+
+void RasterizadorScanline::rasterizarTriangulo(const Poligono& triangulo,
+		const unsigned int faceta, const float nX, const float nY,
+		const float nZ, DestinoFragmentos* const destino,
+		const QRect& area) const {
+	QList<Poligono> trapezios = this->paralelizarTriangulo(triangulo);
+
+	for (const Poligono& p : trapezios) {
+		this->rasterizarTrapezio(p, faceta, nX, nY, nZ, destino, area);
+	}
+}
+
+QList<Poligono> RasterizadorScanline::paralelizarTriangulo(
+		const Poligono& triangulo) const {
+	QList<Poligono> trapezios;
+
+	QList<Ponto> pontos = triangulo.getPontos();
+
+	// Definir P1 com o maior Y
+	Ponto p1 = pontos.at(0);
+
+	for (int i = 1; i < pontos.size(); i++) {
+		Ponto pt = pontos.at(i);
+		if (p1.getY() < pt.getY())
+			p1 = pt;
+	}
+	pontos.removeOne(p1);
+	Ponto p2 = pontos.at(0);
+	Ponto p3 = pontos.at(1);
+
+	// Definir P2 com o menor Y
+	if (p3.getY() < p2.getY()) {
+		Ponto temp = p2;
+		p2 = p3;
+		p3 = temp;
+	}
+
+	//Normalizar
+	// P1 P4
+	// P2 P3
+	if (p1.getY() == p3.getY()) { // Lado (P1, P3) paralelo ao eixo Y
+		if (p3.getX() < p1.getX()) {
+			Ponto temp = p1;
+			p1 = p3;
+			p3 = temp;
+		}
+		trapezios.append(Poligono("", { p1, p2, p2, p3 }, triangulo.getCor()));
+	} else if (p2.getY() == p3.getY()) { // Lado (P2, P3) paralelo ao eixo Y
+		if (p3.getX() < p2.getX()) {
+			Ponto temp = p2;
+			p2 = p3;
+			p3 = temp;
+		}
+		Poligono pol("", { p1, p2, p3, p1 }, triangulo.getCor());
+		trapezios.append(pol);
+	} else { // Triângulo é dividido em dois
+		Ponto p4 = this->calcularInterseccao(p3, Reta("", p1, p2));
+		if (p4.getX() < p3.getX()) {
+			Ponto temp = p4;
+			p4 = p3;
+			p3 = temp;
+		}
+		Poligono trapezio1("", { p1, p3, p4, p1 }, triangulo.getCor());
+		Poligono trapezio2("", { p3, p2, p2, p4 }, triangulo.getCor());
+		trapezios.append(trapezio1);
+		trapezios.append(trapezio2);
+	}
+
+	return trapezios;
+}
+
+Ponto RasterizadorScanline::calcularInterseccao(Ponto p, Reta r) const {
+	double mX = r.coeficienteAngular();
+	double mZ = r.coeficienteAngularZ();
+	double y = p.getY();
+	Ponto pr = r.getPontos().at(0);
+	double x = pr.getX() + (y - pr.getY()) / mX;
+	double z = pr.getZ() + (y - pr.getY()) / mZ;
+	Ponto p4("", x, y, z);
+	return p4;
+}
+
+void RasterizadorScanline::rasterizarTrapezio(const Poligono& trapezio,
+		const unsigned int faceta, const float nX, const float nY,
+		const float nZ, DestinoFragmentos* const destino,
+		const QRect& area) const {
+	QList<Ponto> pontos = trapezio.getPontos();
+
+	Ponto p1 = pontos.at(0);
+	Ponto p2 = pontos.at(1);
+	Ponto p3 = pontos.at(2);
+	Ponto p4 = pontos.at(3);
+	// Normalizar os pontos para as medidas da Viewport
+
+	// Transladar para deixar os pontos entre 0 e 2
+	p1.transladar(1, 1, 0);
+	p2.transladar(1, 1, 0);
+	p3.transladar(1, 1, 0);
+	p4.transladar(1, 1, 0);
+
+	// Escalonar para colocar nas medidas da Viewport
+	double fatorX = (double) this->tamX / 2;
+	double fatorY = (double) this->tamY / 2;
+
+	p1.setX(p1.getX() * fatorX);
+	p2.setX(p2.getX() * fatorX);
+	p3.setX(p3.getX() * fatorX);
+	p4.setX(p4.getX() * fatorX);
+	p1.setY(p1.getY() * fatorY);
+	p2.setY(p2.getY() * fatorY);
+	p3.setY(p3.getY() * fatorY);
+	p4.setY(p4.getY() * fatorY);
+
+	Reta esq("", p1, p2);
+	Reta dir("", p3, p4);
+
+	double mXEsq = esq.coeficienteAngular();
+	double mXDir = dir.coeficienteAngular();
+
+	int inicial = (int) p1.getY();
+	int final = (int) p2.getY();
+
+	double xEsq = p1.getX() + ((double) inicial - p1.getY()) / mXEsq;
+	double xDir = p4.getX() + ((double) inicial - p4.getY()) / mXDir;
+
+	if (xEsq != xEsq)
+		xEsq = p1.getX();
+	if (xDir != xDir)
+		xDir = p4.getX();
+
+	double incXEsq = -1 / mXEsq;
+	double incXDir = -1 / mXDir;
+
+	if (incXEsq != incXEsq)
+		incXEsq = 0;
+	if (incXDir != incXDir)
+		incXDir = 0;
+
+	// Inclinação horizontal do plano do trapézio, a partir do produto
+	// vetorial das bordas (a normal gravada vem pronta da faceta)
+	double x1 = p1.getX() - p2.getX();
+	double y1 = p1.getY() - p2.getY();
+	double z1 = p1.getZ() - p2.getZ();
+	double x2 = p3.getX() - p4.getX();
+	double y2 = p3.getY() - p4.getY();
+	double z2 = p3.getZ() - p4.getZ();
+	double xNormal = y1 * z2 - z1 * y2;
+	double zNormal = x1 * y2 - y1 * x2;
+
+	double mZVer = esq.coeficienteAngularZ();
+	double incZVer = -1 / mZVer;
+
+	if (incZVer != incZVer)
+		incZVer = 0;
+
+	double incZHor = 0;
+	if (zNormal != 0)
+		incZHor = -xNormal / zNormal;
+	double zRef = p1.getZ() + ((double) inicial - p1.getY()) / mZVer;
+	if (zRef != zRef)
+		zRef = p1.getZ();
+
+	for (int y = inicial; y >= final; y--) {
+		int linha = this->tamY - y;
+		int xInicial = (int) xEsq;
+		int xFinal = (int) xDir;
+		double zPix = zRef + (((double) xInicial) - xEsq) * incZHor;
+
+		// Recortar o span na área rasterizada
+		if (xInicial < area.left()) {
+			zPix += (area.left() - xInicial) * incZHor;
+			xInicial = area.left();
+		}
+
+		if (xFinal > area.right())
+			xFinal = area.right();
+
+		if (linha >= area.top() && linha <= area.bottom() && xInicial <= xFinal)
+			destino->escreverSpan(linha, xInicial, xFinal, zPix, incZHor,
+					faceta, nX, nY, nZ);
+
+		xEsq += incXEsq;
+		xDir += incXDir;
+		zRef += incZVer;
+	}
+}
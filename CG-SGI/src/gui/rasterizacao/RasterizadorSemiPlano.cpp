@@ -0,0 +1,197 @@
+#include "gui/rasterizacao/RasterizadorSemiPlano.h"
+
+#include <algorithm>
+#include <climits>
+
+#include "gui/KernelsFragmentos.h"
+
+RasterizadorSemiPlano::RasterizadorSemiPlano(const unsigned int tamX,
+		const unsigned int tamY) :
+		Rasterizador(Rasterizador::SEMI_PLANO, tamX, tamY) {
+}
+
+RasterizadorSemiPlano::~RasterizadorSemiPlano() {
+}
+
+void RasterizadorSemiPlano::rasterizarTriangulo(const Poligono& triangulo,
+		const unsigned int faceta, const float nX, const float nY,
+		const float nZ, DestinoFragmentos* const destino,
+		const QRect& area) const {
+	QList<Ponto> pontos = triangulo.getPontos();
+	const long long UM = 1 << BITS_SUBPIXEL;
+	double fatorX = (double) this->tamX / 2;
+	double fatorY = (double) this->tamY / 2;
+
+	// Vértices fixados na grade de subpixels da tela (y para baixo)
+	long long vX[3];
+	long long vY[3];
+	double vZ[3];
+
+	for (int i = 0; i < 3; i++) {
+		const Ponto& p = pontos.at(i);
+		double x = (p.getX() + 1) * fatorX;
+		double y = (p.getY() + 1) * fatorY;
+
+		if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(p.getZ()))
+			return;
+
+		vX[i] = llround(x * UM);
+		vY[i] = llround((this->tamY - y) * UM);
+		vZ[i] = p.getZ();
+	}
+
+	long long areaDupla = (vX[1] - vX[0]) * (vY[2] - vY[0])
+			- (vY[1] - vY[0]) * (vX[2] - vX[0]);
+
+	if (areaDupla == 0)
+		return;
+
+	// Orientar os vértices para que a área seja positiva
+	if (areaDupla < 0) {
+		std::swap(vX[1], vX[2]);
+		std::swap(vY[1], vY[2]);
+		std::swap(vZ[1], vZ[2]);
+	}
+
+	// Retângulo envolvente em pixels, limitado à área rasterizada
+	int minX = std::max((long long) area.left(),
+			std::min(vX[0], std::min(vX[1], vX[2])) >> BITS_SUBPIXEL);
+	int maxX = std::min((long long) area.right(),
+			std::max(vX[0], std::max(vX[1], vX[2])) >> BITS_SUBPIXEL);
+	int minY = std::max((long long) area.top(),
+			std::min(vY[0], std::min(vY[1], vY[2])) >> BITS_SUBPIXEL);
+	int maxY = std::min((long long) area.bottom(),
+			std::max(vY[0], std::max(vY[1], vY[2])) >> BITS_SUBPIXEL);
+
+	if (minX > maxX || minY > maxY)
+		return;
+
+	// Funções de aresta w = A*x + B*y + C, avaliadas no centro dos pixels:
+	// w(px, py) = passoX*px + passoY*py + w0. A aresta i é oposta ao vértice i.
+	long long passoX[3];
+	long long passoY[3];
+	long long w0[3];
+
+	for (int i = 0; i < 3; i++) {
+		int a = (i + 1) % 3;
+		int b = (i + 2) % 3;
+		long long dX = vX[b] - vX[a];
+		long long dY = vY[b] - vY[a];
+		long long coefA = -dY;
+		long long coefB = dX;
+		long long coefC = dY * vX[a] - dX * vY[a];
+
+		// Regra topo-esquerda: arestas que não são de topo nem da esquerda
+		// não incluem os pixels sobre elas
+		bool topoEsquerda = (dY == 0 && dX > 0) || dY < 0;
+
+		passoX[i] = coefA * UM;
+		passoY[i] = coefB * UM;
+		w0[i] = coefC + (coefA + coefB) * (UM / 2) + (topoEsquerda ? 0 : -1);
+	}
+
+	// Plano de profundidade z(px, py) = zCentro + dzdx*px + dzdy*py
+	double x0 = (double) vX[0] / UM;
+	double y0 = (double) vY[0] / UM;
+	double x1 = (double) vX[1] / UM - x0;
+	double y1 = (double) vY[1] / UM - y0;
+	double x2 = (double) vX[2] / UM - x0;
+	double y2 = (double) vY[2] / UM - y0;
+	double z1 = vZ[1] - vZ[0];
+	double z2 = vZ[2] - vZ[0];
+	double det = x1 * y2 - x2 * y1;
+	double dzdx = (z1 * y2 - z2 * y1) / det;
+	double dzdy = (z2 * x1 - z1 * x2) / det;
+	double zCentro = vZ[0] + dzdx * (0.5 - x0) + dzdy * (0.5 - y0);
+
+	const int B = TAMANHO_BLOCO;
+	const int inicioBlocoX = minX & ~(B - 1);
+	const int inicioBlocoY = minY & ~(B - 1);
+
+	for (int bY = inicioBlocoY; bY <= maxY; bY += B) {
+		int yIni = std::max(bY, minY);
+		int yFim = std::min(bY + B - 1, maxY);
+
+		for (int bX = inicioBlocoX; bX <= maxX; bX += B) {
+			int xIni = std::max(bX, minX);
+			int xFim = std::min(bX + B - 1, maxX);
+
+			// Classificar o bloco pelos cantos. Nos blocos parciais, somente as
+			// arestas que cruzam o bloco precisam ser avaliadas por pixel, e
+			// seus valores ficam limitados à variação dentro do bloco.
+			bool rejeitado = false;
+			bool aceito = true;
+			bool cabeEm32Bits = true;
+			bool cruza[3];
+
+			for (int i = 0; i < 3; i++) {
+				long long w = w0[i] + passoX[i] * bX + passoY[i] * bY;
+				long long dX = passoX[i] * (B - 1);
+				long long dY = passoY[i] * (B - 1);
+				long long wMin = w + std::min(dX, 0LL) + std::min(dY, 0LL);
+				long long wMax = w + std::max(dX, 0LL) + std::max(dY, 0LL);
+
+				if (wMax < 0) {
+					rejeitado = true;
+					break;
+				}
+
+				cruza[i] = wMin < 0;
+
+				if (cruza[i]) {
+					aceito = false;
+
+					if (wMax - wMin > INT_MAX)
+						cabeEm32Bits = false;
+				}
+			}
+
+			if (rejeitado)
+				continue;
+
+			for (int y = yIni; y <= yFim; y++) {
+				double zInicio = zCentro + dzdy * y + dzdx * xIni;
+
+				if (aceito) {
+					destino->escreverSpan(y, xIni, xFim, zInicio, dzdx, faceta,
+							nX, nY, nZ);
+					continue;
+				}
+
+				unsigned int mascara = 0;
+
+				if (cabeEm32Bits) {
+					int w[3];
+					int passo[3];
+
+					for (int i = 0; i < 3; i++) {
+						w[i] = cruza[i] ?
+								(int) (w0[i] + passoX[i] * xIni + passoY[i] * y) : 0;
+						passo[i] = cruza[i] ? (int) passoX[i] : 0;
+					}
+
+					mascara = KernelsFragmentos::calcularCobertura(w, passo,
+							xFim - xIni + 1);
+				} else {
+					long long w[3];
+
+					for (int i = 0; i < 3; i++)
+						w[i] = w0[i] + passoX[i] * xIni + passoY[i] * y;
+
+					for (int x = xIni; x <= xFim; x++) {
+						if ((w[0] | w[1] | w[2]) >= 0)
+							mascara |= 1u << (x - xIni);
+
+						w[0] += passoX[0];
+						w[1] += passoX[1];
+						w[2] += passoX[2];
+					}
+				}
+
+				if (mascara)
+					destino->escreverMascara(y, xIni, mascara, zInicio, dzdx,
+							faceta, nX, nY, nZ);
+			}
+		}
+	}
+}
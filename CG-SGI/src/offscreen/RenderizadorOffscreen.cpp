@@ -0,0 +1,357 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "geometria/Mundo.h"
+#include "gui/Renderizador.h"
+#include "persistencia/ArquivoOBJ.h"
+#include "util/Desempenho.h"
+#include "util/Log.h"
+#include "util/Rastreamento.h"
+
+/**
+ * Renderização sem interface gráfica: carrega uma cena OBJ/MTL, posiciona a
+ * window conforme as opções, renderiza em memória na resolução pedida e
+ * grava a imagem em PPM ou PNG, informando o tempo de cada etapa.
+ *
+ * Uso: Offscreen.app [opções] arquivo.obj
+ *   --saida=arquivo.ppm|arquivo.png  imagem gerada (padrão: saida.ppm)
+ *   --largura=N --altura=N           resolução (padrão: 475x555)
+ *   --margem=N                       margem de clipping em pixels (20)
+ *   --zoom=F                         zoom, como o controle da interface
+ *   --rotacao-x=G --rotacao-y=G --rotacao-z=G
+ *                                    rotação da window, em graus
+ *   --navegar-x=F --navegar-y=F      deslocamento da window
+ *   --projecao=perspectiva|paralela
+ *   --clipping=cohen-sutherland|liang-barsky
+ *   --rasterizacao=scanline|semiplano
+ *   --sombreamento=flat|gouraud|phong
+ *   --ordenacao=submissao|frente|tras
+ *   --preenchimento=solido|aramado|ocultas
+ *   --faces-traseiras                não descartar as faces traseiras
+ *   --threads=N                      threads de renderização (0: todos os núcleos)
+ *   --repeticoes=N                   quadros medidos (padrão: 1)
+ *   --csv=arquivo.csv                histórico de desempenho dos quadros
+ *   --rastreamento=arquivo.json      linha do tempo (Chrome/Perfetto)
+ *   --log=especificacao              níveis do log, descarregado ao final
+ */
+
+/**
+ * Opções da linha de comando.
+ */
+struct Opcoes {
+	String cena;
+	String saida;
+	String csv;
+	String rastreamento;
+	unsigned int largura;
+	unsigned int altura;
+	unsigned int margem;
+	unsigned int threads;
+	unsigned int repeticoes;
+	double zoom;
+	double rotacao[3];
+	double navegacao[2];
+	Projetor::TipoProjecao projecao;
+	Clipping::AlgoritmoClippingLinha clipping;
+	Rasterizador::AlgoritmoRasterizacao rasterizacao;
+	Renderizador::ModoSombreamento sombreamento;
+	Renderizador::ModoOrdenacao ordenacao;
+	Renderizador::ModoPreenchimento preenchimento;
+	bool descarteFacesTraseiras;
+};
+
+/**
+ * Obter o valor de uma opção "--nome=valor".
+ * @return o valor, ou 0 caso o argumento seja de outra opção.
+ */
+static const char* getValor(const char* argumento, const char* nome) {
+	size_t tamanho = strlen(nome);
+
+	if (strncmp(argumento, nome, tamanho) != 0 || argumento[tamanho] != '=')
+		return 0;
+
+	return argumento + tamanho + 1;
+}
+
+/**
+ * Interpretar a linha de comando.
+ * @return false caso alguma opção seja inválida.
+ */
+static bool lerOpcoes(int argc, char *argv[], Opcoes* opcoes) {
+	opcoes->saida = "saida.ppm";
+	opcoes->largura = 475;
+	opcoes->altura = 555;
+	opcoes->margem = 20;
+	opcoes->threads = 0;
+	opcoes->repeticoes = 1;
+	opcoes->zoom = 0;
+	opcoes->rotacao[0] = opcoes->rotacao[1] = opcoes->rotacao[2] = 0;
+	opcoes->navegacao[0] = opcoes->navegacao[1] = 0;
+	opcoes->projecao = Projetor::PERSPECTIVA;
+	opcoes->clipping = Clipping::COHEN_SUTHERLAND;
+	opcoes->rasterizacao = Rasterizador::SCANLINE;
+	opcoes->sombreamento = Renderizador::PHONG;
+	opcoes->ordenacao = Renderizador::FRENTE_PARA_TRAS;
+	opcoes->preenchimento = Renderizador::SOLIDO;
+	opcoes->descarteFacesTraseiras = true;
+
+	for (int i = 1; i < argc; i++) {
+		const char* a = argv[i];
+		const char* v;
+
+		if (a[0] != '-') {
+			opcoes->cena = a;
+		} else if ((v = getValor(a, "--saida"))) {
+			opcoes->saida = v;
+		} else if ((v = getValor(a, "--largura"))) {
+			opcoes->largura = atoi(v);
+		} else if ((v = getValor(a, "--altura"))) {
+			opcoes->altura = atoi(v);
+		} else if ((v = getValor(a, "--margem"))) {
+			opcoes->margem = atoi(v);
+		} else if ((v = getValor(a, "--threads"))) {
+			opcoes->threads = atoi(v);
+		} else if ((v = getValor(a, "--repeticoes"))) {
+			opcoes->repeticoes = std::max(1, atoi(v));
+		} else if ((v = getValor(a, "--zoom"))) {
+			opcoes->zoom = atof(v);
+		} else if ((v = getValor(a, "--rotacao-x"))) {
+			opcoes->rotacao[0] = atof(v);
+		} else if ((v = getValor(a, "--rotacao-y"))) {
+			opcoes->rotacao[1] = atof(v);
+		} else if ((v = getValor(a, "--rotacao-z"))) {
+			opcoes->rotacao[2] = atof(v);
+		} else if ((v = getValor(a, "--navegar-x"))) {
+			opcoes->navegacao[0] = atof(v);
+		} else if ((v = getValor(a, "--navegar-y"))) {
+			opcoes->navegacao[1] = atof(v);
+		} else if ((v = getValor(a, "--projecao"))) {
+			if (strcmp(v, "paralela") == 0)
+				opcoes->projecao = Projetor::PARALELA_ORTOGONAL;
+			else if (strcmp(v, "perspectiva") == 0)
+				opcoes->projecao = Projetor::PERSPECTIVA;
+			else
+				return false;
+		} else if ((v = getValor(a, "--clipping"))) {
+			if (strcmp(v, "cohen-sutherland") == 0)
+				opcoes->clipping = Clipping::COHEN_SUTHERLAND;
+			else if (strcmp(v, "liang-barsky") == 0)
+				opcoes->clipping = Clipping::LIANG_BARSKY;
+			else
+				return false;
+		} else if ((v = getValor(a, "--rasterizacao"))) {
+			if (strcmp(v, "scanline") == 0)
+				opcoes->rasterizacao = Rasterizador::SCANLINE;
+			else if (strcmp(v, "semiplano") == 0)
+				opcoes->rasterizacao = Rasterizador::SEMI_PLANO;
+			else
+				return false;
+		} else if ((v = getValor(a, "--sombreamento"))) {
+			if (strcmp(v, "flat") == 0)
+				opcoes->sombreamento = Renderizador::FLAT;
+			else if (strcmp(v, "gouraud") == 0)
+				opcoes->sombreamento = Renderizador::GOURAUD;
+			else if (strcmp(v, "phong") == 0)
+				opcoes->sombreamento = Renderizador::PHONG;
+			else
+				return false;
+		} else if ((v = getValor(a, "--ordenacao"))) {
+			if (strcmp(v, "submissao") == 0)
+				opcoes->ordenacao = Renderizador::SUBMISSAO;
+			else if (strcmp(v, "frente") == 0)
+				opcoes->ordenacao = Renderizador::FRENTE_PARA_TRAS;
+			else if (strcmp(v, "tras") == 0)
+				opcoes->ordenacao = Renderizador::TRAS_PARA_FRENTE;
+			else
+				return false;
+		} else if ((v = getValor(a, "--preenchimento"))) {
+			if (strcmp(v, "solido") == 0)
+				opcoes->preenchimento = Renderizador::SOLIDO;
+			else if (strcmp(v, "aramado") == 0)
+				opcoes->preenchimento = Renderizador::ARAMADO;
+			else if (strcmp(v, "ocultas") == 0)
+				opcoes->preenchimento = Renderizador::LINHAS_OCULTAS;
+			else
+				return false;
+		} else if (strcmp(a, "--faces-traseiras") == 0) {
+			opcoes->descarteFacesTraseiras = false;
+		} else if ((v = getValor(a, "--csv"))) {
+			opcoes->csv = v;
+		} else if ((v = getValor(a, "--rastreamento"))) {
+			opcoes->rastreamento = v;
+		} else if ((v = getValor(a, "--log"))) {
+			if (!Log::configurar(v))
+				return false;
+		} else {
+			return false;
+		}
+	}
+
+	return !opcoes->cena.empty() && opcoes->largura > 2 * opcoes->margem
+			&& opcoes->altura > 2 * opcoes->margem;
+}
+
+/**
+ * Gravar a imagem em PPM binário (P6), sem depender dos plugins de imagem.
+ * @return false caso o arquivo não possa ser escrito.
+ */
+static bool gravarPPM(const QImage& imagem, const String& caminho) {
+	FILE* arquivo = fopen(caminho.c_str(), "wb");
+
+	if (arquivo == 0)
+		return false;
+
+	fprintf(arquivo, "P6\n%d %d\n255\n", imagem.width(), imagem.height());
+	std::vector<unsigned char> linha(3 * imagem.width());
+
+	for (int y = 0; y < imagem.height(); y++) {
+		const QRgb* pixels = (const QRgb*) imagem.constScanLine(y);
+
+		for (int x = 0; x < imagem.width(); x++) {
+			linha[3 * x] = qRed(pixels[x]);
+			linha[3 * x + 1] = qGreen(pixels[x]);
+			linha[3 * x + 2] = qBlue(pixels[x]);
+		}
+
+		fwrite(linha.data(), 1, linha.size(), arquivo);
+	}
+
+	return fclose(arquivo) == 0;
+}
+
+/**
+ * Obter a mediana de um conjunto de medidas.
+ */
+static double mediana(std::vector<long long> valores) {
+	std::sort(valores.begin(), valores.end());
+	size_t n = valores.size();
+
+	return n % 2 ? valores[n / 2] : (valores[n / 2 - 1] + valores[n / 2]) / 2.0;
+}
+
+int main(int argc, char *argv[]) {
+	Opcoes opcoes;
+	Rastreamento::nomearThread("principal");
+
+	if (!lerOpcoes(argc, argv, &opcoes)) {
+		fprintf(stderr, "Uso: %s [opções] arquivo.obj "
+				"(veja src/offscreen/RenderizadorOffscreen.cpp)\n", argv[0]);
+		return 2;
+	}
+
+	if (!opcoes.rastreamento.empty())
+		Rastreamento::setHabilitado(true);
+
+	Mundo mundo;
+	long long inicioCarga = Log::getInstante();
+
+	try {
+		ArquivoOBJ arquivo(opcoes.cena);
+		arquivo.carregar();
+		Cena* cena = arquivo.getCena();
+
+		for (ObjetoGeometrico* objeto : cena->getObjetos())
+			mundo.inserirObjeto(*objeto);
+
+		delete cena;
+	} catch (Excecao& ex) {
+		fprintf(stderr, "%s\n", ex.getMensagem().c_str());
+		Log::descarregar(stderr);
+		return 1;
+	}
+
+	double tempoCarga = (Log::getInstante() - inicioCarga) / 1e6;
+
+	// Posicionar a window como os controles da interface
+	if (opcoes.zoom != 0)
+		mundo.aplicarZoom(opcoes.zoom);
+
+	if (opcoes.navegacao[0] != 0)
+		mundo.navegar(Mundo::DIREITA, opcoes.navegacao[0]);
+
+	if (opcoes.navegacao[1] != 0)
+		mundo.navegar(Mundo::CIMA, opcoes.navegacao[1]);
+
+	Mundo::Eixo eixos[3] = { Mundo::EIXO_X, Mundo::EIXO_Y, Mundo::EIXO_Z };
+
+	for (int i = 0; i < 3; i++)
+		if (opcoes.rotacao[i] != 0)
+			mundo.rotacionarVisualizacao(opcoes.rotacao[i], eixos[i]);
+
+	Renderizador renderizador(opcoes.largura, opcoes.altura, opcoes.margem,
+			opcoes.threads);
+	renderizador.setAlgoritmoClippingLinhas(opcoes.clipping);
+	renderizador.setAlgoritmoRasterizacao(opcoes.rasterizacao);
+	renderizador.setModoSombreamento(opcoes.sombreamento);
+	renderizador.setModoOrdenacao(opcoes.ordenacao);
+	renderizador.setModoPreenchimento(opcoes.preenchimento);
+	renderizador.setDescarteFacesTraseiras(opcoes.descarteFacesTraseiras);
+	QImage imagem(opcoes.largura, opcoes.altura, QImage::Format_ARGB32);
+
+	// Cada quadro projeta a cena novamente, como uma mudança de visualização
+	Desempenho::finalizarQuadro();
+	Desempenho::limparHistorico();
+
+	for (unsigned int i = 0; i < opcoes.repeticoes; i++) {
+		mundo.setProjetorVisualizacao(opcoes.projecao);
+		renderizador.renderizar(mundo.getObjetosNormalizados(), &imagem);
+		Desempenho::finalizarQuadro();
+	}
+
+	bool png = opcoes.saida.size() >= 4
+			&& opcoes.saida.compare(opcoes.saida.size() - 4, 4, ".png") == 0;
+	bool gravada = png ?
+			imagem.save(QString::fromStdString(opcoes.saida), "PNG") :
+			gravarPPM(imagem, opcoes.saida);
+
+	if (!gravada)
+		fprintf(stderr, "Não foi possível gravar %s\n", opcoes.saida.c_str());
+
+	// Medianas e mínimos dos quadros medidos
+	int numQuadros = Desempenho::getNumQuadros();
+	std::vector<long long> duracoes(numQuadros);
+	std::vector<std::vector<long long> > etapas(Desempenho::NUM_ETAPAS,
+			std::vector<long long>(numQuadros));
+
+	for (int k = 0; k < numQuadros; k++) {
+		Desempenho::Quadro quadro = Desempenho::getQuadro(k);
+		duracoes[k] = quadro.duracao;
+
+		for (int i = 0; i < Desempenho::NUM_ETAPAS; i++)
+			etapas[i][k] = quadro.etapas[i];
+	}
+
+	printf("cena %s: %d objetos carregados em %.2f ms\n", opcoes.cena.c_str(),
+			mundo.getObjetosReais().size(), tempoCarga);
+	printf("%ux%u, %u threads, %d quadros\n", opcoes.largura, opcoes.altura,
+			renderizador.getNumThreads(), numQuadros);
+	printf("%-14s %10s %10s\n", "etapa", "mediana ms", "minimo ms");
+	printf("%-14s %10.3f %10.3f\n", "quadro", mediana(duracoes) / 1e6,
+			*std::min_element(duracoes.begin(), duracoes.end()) / 1e6);
+
+	for (int i = 0; i < Desempenho::NUM_ETAPAS; i++)
+		printf("%-14s %10.3f %10.3f\n",
+				Desempenho::getNome((Desempenho::Etapa) i),
+				mediana(etapas[i]) / 1e6,
+				*std::min_element(etapas[i].begin(), etapas[i].end()) / 1e6);
+
+	Desempenho::Quadro ultimo = Desempenho::getQuadro(0);
+
+	for (int i = 0; i < Desempenho::NUM_CONTADORES; i++)
+		printf("%-22s %llu\n", Desempenho::getNome((Desempenho::Contador) i),
+				ultimo.contadores[i]);
+
+	if (!opcoes.csv.empty() && !Desempenho::exportarCSV(opcoes.csv))
+		fprintf(stderr, "Não foi possível gravar %s\n", opcoes.csv.c_str());
+
+	if (!opcoes.rastreamento.empty()
+			&& !Rastreamento::exportar(opcoes.rastreamento))
+		fprintf(stderr, "Não foi possível gravar %s\n",
+				opcoes.rastreamento.c_str());
+
+	Log::descarregar(stderr);
+	return gravada ? 0 : 1;
+}
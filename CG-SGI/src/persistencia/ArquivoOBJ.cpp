@@ -1,4 +1,6 @@
 #include "persistencia/ArquivoOBJ.h"
+#include "util/Log.h"
+#include "util/Rastreamento.h"
 
 const String ArquivoOBJ::BASIC_MAN = "samples/basicman.sample";
 const String ArquivoOBJ::CRISTO_REDENTOR = "samples/cristo.sample";
@@ -10,6 +12,7 @@ ArquivoOBJ::ArquivoOBJ(const String& nome) : Arquivo(nome) {
 ArquivoOBJ::~ArquivoOBJ() {}
 
 void ArquivoOBJ::carregar() throw(ExcecaoArquivoInvalido, ExcecaoLeituraArquivo) {
+	Rastreamento::Intervalo intervalo("carregar OBJ", "persistencia");
 	this->removerObjetos();
 
 	std::ifstream arquivo(this->getNome().c_str());
@@ -72,6 +75,7 @@ void ArquivoOBJ::carregar() throw(ExcecaoArquivoInvalido, ExcecaoLeituraArquivo)
 		if(tipo.compare("f") != 0 && tipo.at(0) != '#' && tipo.compare("v") != 0
 				&& tipo.compare("usemtl") != 0 && anteriorEraFace) {
 			this->objetos.append(new Objeto3D(nomeObjeto, pontosObjeto3d.values(), facetas));
+			this->limpar(pontosObjeto3d.values());
 			pontosObjeto3d.clear();
 			pontosObjeto3dCopia.clear();
 			facetas.clear();
@@ -205,11 +209,16 @@ void ArquivoOBJ::carregar() throw(ExcecaoArquivoInvalido, ExcecaoLeituraArquivo)
 
 	}
 
+	// A malha do objeto 3D copia os pontos, que não são mais necessários
 	if(facetas.size() > 0)
 		this->objetos.append(new Objeto3D(nomeObjeto, pontosObjeto3d.values(), facetas));
 
+	this->limpar(pontosObjeto3d.values());
+
 	arquivo.close();
 	this->limpar(pontos.values());
+	LOG_INFORMACAO(Log::PERSISTENCIA, "%s: %d objetos carregados",
+			this->getNome().c_str(), this->objetos.size());
 }
 
 void ArquivoOBJ::gravar() const throw(ExcecaoEscritaArquivo) {
@@ -0,0 +1,215 @@
+#include "util/Desempenho.h"
+#include "util/Log.h"
+#include "util/Rastreamento.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+static const char* const NOMES_ETAPAS[] = { "projecao", "clipping",
+		"triangulacao", "distribuicao", "rasterizacao", "iluminacao",
+		"apresentacao" };
+static const char* const NOMES_CONTADORES[] = { "objetos", "facetas",
+		"triangulos", "fragmentos", "rejeicoes_profundidade", "alocacoes" };
+
+static std::atomic<unsigned long long> alocacoes(0);
+
+// Quadro corrente: -1 enquanto nenhuma etapa foi medida desde o fechamento
+static std::atomic<long long> inicioQuadro(-1);
+static std::atomic<unsigned long long> alocacoesInicioQuadro(0);
+static std::atomic<long long> temposEtapas[Desempenho::NUM_ETAPAS];
+static std::atomic<unsigned long long> contadores[Desempenho::NUM_CONTADORES];
+
+static std::mutex mutexHistorico;
+static Desempenho::Quadro historico[Desempenho::CAPACIDADE_HISTORICO];
+static unsigned long long numQuadros = 0;
+
+#ifdef CONTAR_ALOCACOES
+// Substitui o alocador de todo o processo: somente para diagnóstico. As
+// alocações dos contêineres do Qt (malloc) não passam por aqui
+void* operator new(std::size_t tamanho) {
+	alocacoes.fetch_add(1, std::memory_order_relaxed);
+	void* memoria = malloc(tamanho > 0 ? tamanho : 1);
+
+	if (memoria == 0)
+		throw std::bad_alloc();
+
+	return memoria;
+}
+
+void operator delete(void* memoria) noexcept {
+	free(memoria);
+}
+#endif /* CONTAR_ALOCACOES */
+
+/**
+ * Marcar o início do quadro corrente, caso ainda não tenha começado.
+ */
+static void iniciarQuadro(const long long instante) {
+	long long semQuadro = -1;
+
+	if (inicioQuadro.load(std::memory_order_relaxed) == -1
+			&& inicioQuadro.compare_exchange_strong(semQuadro, instante))
+		alocacoesInicioQuadro.store(alocacoes.load(std::memory_order_relaxed),
+				std::memory_order_relaxed);
+}
+
+Desempenho::Cronometro::Cronometro(const Etapa etapa) {
+	this->etapa = etapa;
+	this->inicio = Log::getInstante();
+	iniciarQuadro(this->inicio);
+}
+
+Desempenho::Cronometro::~Cronometro() {
+	long long duracao = Log::getInstante() - this->inicio;
+	Desempenho::adicionarTempo(this->etapa, duracao);
+
+	if (Rastreamento::isHabilitado())
+		Rastreamento::registrar(NOMES_ETAPAS[this->etapa], "etapa",
+				this->inicio, duracao);
+}
+
+void Desempenho::adicionarTempo(const Etapa etapa, const long long duracao) {
+	iniciarQuadro(Log::getInstante() - duracao);
+	temposEtapas[etapa].fetch_add(duracao, std::memory_order_relaxed);
+}
+
+void Desempenho::contar(const Contador contador,
+		const unsigned long long valor) {
+	contadores[contador].fetch_add(valor, std::memory_order_relaxed);
+}
+
+void Desempenho::finalizarQuadro() {
+	long long inicio = inicioQuadro.load(std::memory_order_relaxed);
+
+	if (inicio == -1)
+		return;
+
+	Quadro quadro;
+	quadro.inicio = inicio;
+	quadro.duracao = Log::getInstante() - inicio;
+
+	for (int i = 0; i < NUM_ETAPAS; i++)
+		quadro.etapas[i] = temposEtapas[i].exchange(0,
+				std::memory_order_relaxed);
+
+	for (int i = 0; i < NUM_CONTADORES; i++)
+		quadro.contadores[i] = contadores[i].exchange(0,
+				std::memory_order_relaxed);
+
+	quadro.contadores[ALOCACOES] = alocacoes.load(std::memory_order_relaxed)
+			- alocacoesInicioQuadro.load(std::memory_order_relaxed);
+	inicioQuadro.store(-1, std::memory_order_relaxed);
+
+	std::lock_guard<std::mutex> trava(mutexHistorico);
+	quadro.numero = numQuadros;
+	historico[numQuadros % CAPACIDADE_HISTORICO] = quadro;
+	numQuadros++;
+}
+
+int Desempenho::getNumQuadros() {
+	std::lock_guard<std::mutex> trava(mutexHistorico);
+
+	return numQuadros < (unsigned long long) CAPACIDADE_HISTORICO ?
+			(int) numQuadros : CAPACIDADE_HISTORICO;
+}
+
+Desempenho::Quadro Desempenho::getQuadro(const int indice) {
+	std::lock_guard<std::mutex> trava(mutexHistorico);
+	Quadro vazio = { 0, 0, 0, { 0 }, { 0 } };
+
+	// Fora do histórico o índice daria a volta em aritmética sem sinal
+	if (indice < 0 || (unsigned long long) indice >= numQuadros
+			|| indice >= CAPACIDADE_HISTORICO)
+		return vazio;
+
+	return historico[(numQuadros - 1 - indice) % CAPACIDADE_HISTORICO];
+}
+
+Desempenho::Quadro Desempenho::getMedia(const int numQuadros) {
+	int n = std::min(numQuadros, Desempenho::getNumQuadros());
+	Quadro media = { 0, 0, 0, { 0 }, { 0 } };
+
+	if (n <= 0)
+		return media;
+
+	for (int k = 0; k < n; k++) {
+		Quadro quadro = Desempenho::getQuadro(k);
+
+		if (k == 0) {
+			media.numero = quadro.numero;
+			media.inicio = quadro.inicio;
+		}
+
+		media.duracao += quadro.duracao;
+
+		for (int i = 0; i < NUM_ETAPAS; i++)
+			media.etapas[i] += quadro.etapas[i];
+
+		for (int i = 0; i < NUM_CONTADORES; i++)
+			media.contadores[i] += quadro.contadores[i];
+	}
+
+	media.duracao /= n;
+
+	for (int i = 0; i < NUM_ETAPAS; i++)
+		media.etapas[i] /= n;
+
+	for (int i = 0; i < NUM_CONTADORES; i++)
+		media.contadores[i] /= n;
+
+	return media;
+}
+
+void Desempenho::limparHistorico() {
+	std::lock_guard<std::mutex> trava(mutexHistorico);
+	numQuadros = 0;
+}
+
+bool Desempenho::exportarCSV(const std::string& caminho) {
+	FILE* arquivo = fopen(caminho.c_str(), "w");
+
+	if (arquivo == 0)
+		return false;
+
+	fprintf(arquivo, "quadro,inicio_ms,duracao_ms");
+
+	for (int i = 0; i < NUM_ETAPAS; i++)
+		fprintf(arquivo, ",%s_ms", NOMES_ETAPAS[i]);
+
+	for (int i = 0; i < NUM_CONTADORES; i++)
+		fprintf(arquivo, ",%s", NOMES_CONTADORES[i]);
+
+	fprintf(arquivo, "\n");
+
+	for (int k = Desempenho::getNumQuadros() - 1; k >= 0; k--) {
+		Quadro quadro = Desempenho::getQuadro(k);
+		fprintf(arquivo, "%llu,%.3f,%.3f", quadro.numero, quadro.inicio / 1e6,
+				quadro.duracao / 1e6);
+
+		for (int i = 0; i < NUM_ETAPAS; i++)
+			fprintf(arquivo, ",%.3f", quadro.etapas[i] / 1e6);
+
+		for (int i = 0; i < NUM_CONTADORES; i++)
+			fprintf(arquivo, ",%llu", quadro.contadores[i]);
+
+		fprintf(arquivo, "\n");
+	}
+
+	return fclose(arquivo) == 0;
+}
+
+unsigned long long Desempenho::getNumAlocacoes() {
+	return alocacoes.load(std::memory_order_relaxed);
+}
+
+const char* Desempenho::getNome(const Etapa etapa) {
+	return NOMES_ETAPAS[etapa];
+}
+
+const char* Desempenho::getNome(const Contador contador) {
+	return NOMES_CONTADORES[contador];
+}
@@ -0,0 +1,206 @@
+#include "util/Log.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstring>
+#include <sstream>
+
+/**
+ * Entrada do buffer circular. A sequência vale 0 enquanto a entrada é
+ * escrita e s + 1 depois que a mensagem de número s foi publicada.
+ */
+struct EntradaLog {
+	std::atomic<unsigned long long> sequencia;
+	long long instante;
+	unsigned int thread;
+	unsigned char categoria;
+	unsigned char nivel;
+	char mensagem[Log::TAMANHO_MENSAGEM];
+};
+
+static const char* const NOMES_NIVEIS[] = { "depuracao", "informacao",
+		"aviso", "erro", "nenhum" };
+static const char* const NOMES_CATEGORIAS[] = { "renderizacao", "clipping",
+		"persistencia", "mundo" };
+
+// Níveis das categorias, 4 bits cada; por padrão somente avisos e erros
+static std::atomic<unsigned int> niveis(Log::AVISO * 0x1111u);
+static EntradaLog entradas[Log::CAPACIDADE];
+static std::atomic<unsigned long long> proximaEntrada(0);
+static unsigned long long proximaLeitura = 0;
+static std::atomic<unsigned int> proximaThread(0);
+static const std::chrono::steady_clock::time_point inicio =
+		std::chrono::steady_clock::now();
+
+bool Log::isHabilitado(const Categoria categoria, const Nivel nivel) {
+	unsigned int minimo = (niveis.load(std::memory_order_relaxed)
+			>> (4 * categoria)) & 0xF;
+
+	return (unsigned int) nivel >= minimo && nivel != NENHUM;
+}
+
+void Log::setNivel(const Categoria categoria, const Nivel nivel) {
+	unsigned int atual = niveis.load(std::memory_order_relaxed);
+	unsigned int novo;
+
+	do {
+		novo = (atual & ~(0xFu << (4 * categoria)))
+				| ((unsigned int) nivel << (4 * categoria));
+	} while (!niveis.compare_exchange_weak(atual, novo,
+			std::memory_order_relaxed));
+}
+
+void Log::setNivel(const Nivel nivel) {
+	for (int i = 0; i < NUM_CATEGORIAS; i++)
+		Log::setNivel((Categoria) i, nivel);
+}
+
+Log::Nivel Log::getNivel(const Categoria categoria) {
+	return (Nivel) ((niveis.load(std::memory_order_relaxed) >> (4 * categoria))
+			& 0xF);
+}
+
+bool Log::configurar(const std::string& especificacao) {
+	std::stringstream itens(especificacao);
+	std::string item;
+	bool valido = true;
+
+	while (std::getline(itens, item, ',')) {
+		if (item.empty())
+			continue;
+
+		size_t igual = item.find('=');
+		std::string nomeCategoria =
+				igual == std::string::npos ? "" : item.substr(0, igual);
+		std::string nomeNivel =
+				igual == std::string::npos ? item : item.substr(igual + 1);
+		int nivel = -1;
+		int categoria = -1;
+
+		for (int i = 0; i <= NENHUM; i++)
+			if (nomeNivel == NOMES_NIVEIS[i])
+				nivel = i;
+
+		for (int i = 0; i < NUM_CATEGORIAS; i++)
+			if (nomeCategoria == NOMES_CATEGORIAS[i])
+				categoria = i;
+
+		if (nivel < 0 || (igual != std::string::npos && categoria < 0)) {
+			valido = false;
+			continue;
+		}
+
+		if (categoria < 0)
+			Log::setNivel((Nivel) nivel);
+		else
+			Log::setNivel((Categoria) categoria, (Nivel) nivel);
+	}
+
+	return valido;
+}
+
+void Log::registrar(const Categoria categoria, const Nivel nivel,
+		const char* formato, ...) {
+	unsigned long long sequencia = proximaEntrada.fetch_add(1,
+			std::memory_order_relaxed);
+	EntradaLog& entrada = entradas[sequencia & (CAPACIDADE - 1)];
+
+	// Invalidar a entrada antes de sobrescrevê-la
+	entrada.sequencia.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	entrada.instante = Log::getInstante();
+	entrada.thread = Log::getThreadAtual();
+	entrada.categoria = categoria;
+	entrada.nivel = nivel;
+
+	va_list argumentos;
+	va_start(argumentos, formato);
+	vsnprintf(entrada.mensagem, TAMANHO_MENSAGEM, formato, argumentos);
+	va_end(argumentos);
+
+	entrada.sequencia.store(sequencia + 1, std::memory_order_release);
+}
+
+unsigned long long Log::coletar(std::vector<Registro>* registros) {
+	unsigned long long fim = proximaEntrada.load(std::memory_order_acquire);
+	unsigned long long perdidas = 0;
+
+	// Entradas mais antigas que a capacidade já foram sobrescritas
+	if (fim - proximaLeitura > CAPACIDADE) {
+		perdidas += fim - CAPACIDADE - proximaLeitura;
+		proximaLeitura = fim - CAPACIDADE;
+	}
+
+	for (; proximaLeitura < fim; proximaLeitura++) {
+		EntradaLog& entrada = entradas[proximaLeitura & (CAPACIDADE - 1)];
+		unsigned long long sequencia = entrada.sequencia.load(
+				std::memory_order_acquire);
+
+		// Ainda sendo escrita: lida na próxima coleta, mantendo a ordem
+		if (sequencia == 0)
+			break;
+
+		if (sequencia != proximaLeitura + 1) {
+			perdidas++;
+			continue;
+		}
+
+		Registro registro;
+		registro.sequencia = proximaLeitura;
+		registro.instante = entrada.instante;
+		registro.thread = entrada.thread;
+		registro.categoria = (Categoria) entrada.categoria;
+		registro.nivel = (Nivel) entrada.nivel;
+		registro.mensagem = std::string(entrada.mensagem,
+				strnlen(entrada.mensagem, TAMANHO_MENSAGEM));
+
+		// Descartar a cópia se a entrada foi sobrescrita durante a leitura
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if (entrada.sequencia.load(std::memory_order_relaxed) != sequencia) {
+			perdidas++;
+			continue;
+		}
+
+		registros->push_back(registro);
+	}
+
+	return perdidas;
+}
+
+void Log::descarregar(FILE* const destino) {
+	std::vector<Registro> registros;
+	unsigned long long perdidas = Log::coletar(&registros);
+
+	for (const Registro& r : registros)
+		fprintf(destino, "[%12.3f ms] [thread %u] %s/%s: %s\n",
+				r.instante / 1e6, r.thread, Log::getNome(r.categoria),
+				Log::getNome(r.nivel), r.mensagem.c_str());
+
+	if (perdidas > 0)
+		fprintf(destino, "%llu mensagens de log perdidas\n", perdidas);
+
+	fflush(destino);
+}
+
+const char* Log::getNome(const Nivel nivel) {
+	return NOMES_NIVEIS[nivel];
+}
+
+const char* Log::getNome(const Categoria categoria) {
+	return NOMES_CATEGORIAS[categoria];
+}
+
+unsigned int Log::getThreadAtual() {
+	static thread_local unsigned int thread = proximaThread.fetch_add(1,
+			std::memory_order_relaxed);
+
+	return thread;
+}
+
+long long Log::getInstante() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - inicio).count();
+}
@@ -0,0 +1,49 @@
+#include "util/OrdenacaoRadix.h"
+
+#include <cstring>
+
+void OrdenacaoRadix::ordenar(const std::vector<unsigned long long>& chaves,
+		std::vector<unsigned int>* indices) {
+	unsigned int n = chaves.size();
+	std::vector<unsigned int> auxiliar(n);
+	indices->resize(n);
+
+	for (unsigned int i = 0; i < n; i++)
+		(*indices)[i] = i;
+
+	// Histogramas de todos os dígitos em uma única leitura das chaves
+	unsigned int contagens[8][256] = { };
+
+	for (unsigned long long chave : chaves)
+		for (int d = 0; d < 8; d++)
+			contagens[d][(chave >> (8 * d)) & 0xFF]++;
+
+	for (int d = 0; d < 8; d++) {
+		unsigned int* contagem = contagens[d];
+
+		// Dígito igual em todas as chaves não altera a ordem
+		if (n == 0 || contagem[(chaves[0] >> (8 * d)) & 0xFF] == n)
+			continue;
+
+		unsigned int posicao = 0;
+
+		for (int b = 0; b < 256; b++) {
+			unsigned int quantidade = contagem[b];
+			contagem[b] = posicao;
+			posicao += quantidade;
+		}
+
+		for (unsigned int i : *indices)
+			auxiliar[contagem[(chaves[i] >> (8 * d)) & 0xFF]++] = i;
+
+		indices->swap(auxiliar);
+	}
+}
+
+unsigned int OrdenacaoRadix::converterProfundidade(const float z) {
+	unsigned int bits;
+	memcpy(&bits, &z, sizeof(bits));
+
+	// Negativos têm todos os bits invertidos; positivos, somente o de sinal
+	return (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+}
@@ -0,0 +1,101 @@
+#include "util/PoolThreads.h"
+#include "util/Rastreamento.h"
+
+PoolThreads::PoolThreads(const unsigned int numThreads) {
+	unsigned int total = numThreads;
+
+	if (total == 0)
+		total = std::thread::hardware_concurrency();
+
+	if (total == 0)
+		total = 1;
+
+	this->tarefa = 0;
+	this->numTarefas = 0;
+	this->proximaTarefa = 0;
+	this->trabalhadorasAtivas = 0;
+	this->lote = 0;
+	this->encerrar = false;
+
+	// A thread que submete os lotes também executa tarefas
+	for (unsigned int i = 1; i < total; i++)
+		this->trabalhadoras.push_back(std::thread(&PoolThreads::trabalhar, this));
+}
+
+PoolThreads::~PoolThreads() {
+	{
+		std::lock_guard<std::mutex> trava(this->mutex);
+		this->encerrar = true;
+	}
+
+	this->condicaoLote.notify_all();
+
+	for (std::thread& t : this->trabalhadoras)
+		t.join();
+}
+
+unsigned int PoolThreads::getNumThreads() const {
+	return this->trabalhadoras.size() + 1;
+}
+
+void PoolThreads::executar(const unsigned int numTarefas,
+		const std::function<void(unsigned int)>& tarefa) {
+	if (numTarefas == 0)
+		return;
+
+	if (this->trabalhadoras.empty() || numTarefas == 1) {
+		for (unsigned int i = 0; i < numTarefas; i++)
+			tarefa(i);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> trava(this->mutex);
+		this->tarefa = &tarefa;
+		this->numTarefas = numTarefas;
+		this->proximaTarefa = 0;
+		this->trabalhadorasAtivas = this->trabalhadoras.size();
+		this->lote++;
+	}
+
+	this->condicaoLote.notify_all();
+	this->consumirTarefas();
+
+	// Espera pelas trabalhadoras que ainda executam tarefas do lote
+	Rastreamento::Intervalo intervalo("aguardar lote", "threads");
+	std::unique_lock<std::mutex> trava(this->mutex);
+	this->condicaoFim.wait(trava,
+			[this] {return this->trabalhadorasAtivas == 0;});
+	this->tarefa = 0;
+}
+
+void PoolThreads::trabalhar() {
+	unsigned long ultimoLote = 0;
+	Rastreamento::nomearThread("trabalhadora");
+
+	while (true) {
+		{
+			std::unique_lock<std::mutex> trava(this->mutex);
+			this->condicaoLote.wait(trava, [this, ultimoLote] {
+				return this->encerrar || this->lote != ultimoLote;});
+
+			if (this->encerrar)
+				return;
+
+			ultimoLote = this->lote;
+		}
+
+		this->consumirTarefas();
+
+		std::lock_guard<std::mutex> trava(this->mutex);
+
+		if (--this->trabalhadorasAtivas == 0)
+			this->condicaoFim.notify_one();
+	}
+}
+
+void PoolThreads::consumirTarefas() {
+	for (unsigned int i = this->proximaTarefa++; i < this->numTarefas;
+			i = this->proximaTarefa++)
+		(*this->tarefa)(i);
+}
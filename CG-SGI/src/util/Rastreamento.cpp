@@ -0,0 +1,155 @@
+#include "util/Rastreamento.h"
+#include "util/Log.h"
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+
+/**
+ * Entrada do buffer circular, publicada pela sequência como no log: 0
+ * enquanto é escrita e s + 1 depois que o intervalo de número s foi
+ * gravado.
+ */
+struct EntradaRastreamento {
+	std::atomic<unsigned long long> sequencia;
+	const char* nome;
+	const char* categoria;
+	long long inicio;
+	long long duracao;
+	unsigned int thread;
+	int argumento;
+};
+
+static std::atomic<bool> habilitado(false);
+static std::atomic<EntradaRastreamento*> entradas(0);
+static std::atomic<unsigned long long> proximaEntrada(0);
+static std::mutex mutexThreads;
+static std::string nomesThreads[Rastreamento::MAXIMO_THREADS];
+
+Rastreamento::Intervalo::Intervalo(const char* nome, const char* categoria,
+		const int argumento) {
+	this->nome = nome;
+	this->categoria = categoria;
+	this->argumento = argumento;
+	this->inicio = Rastreamento::isHabilitado() ? Log::getInstante() : -1;
+}
+
+Rastreamento::Intervalo::~Intervalo() {
+	if (this->inicio >= 0)
+		Rastreamento::registrar(this->nome, this->categoria, this->inicio,
+				Log::getInstante() - this->inicio, this->argumento);
+}
+
+void Rastreamento::setHabilitado(const bool habilitar) {
+	if (habilitar && entradas.load() == 0) {
+		std::lock_guard<std::mutex> trava(mutexThreads);
+
+		if (entradas.load() == 0)
+			entradas.store(new EntradaRastreamento[CAPACIDADE]());
+	}
+
+	habilitado.store(habilitar, std::memory_order_relaxed);
+}
+
+bool Rastreamento::isHabilitado() {
+	return habilitado.load(std::memory_order_relaxed);
+}
+
+void Rastreamento::registrar(const char* nome, const char* categoria,
+		const long long inicio, const long long duracao,
+		const int argumento) {
+	EntradaRastreamento* buffer = entradas.load(std::memory_order_acquire);
+
+	if (buffer == 0)
+		return;
+
+	unsigned long long sequencia = proximaEntrada.fetch_add(1,
+			std::memory_order_relaxed);
+	EntradaRastreamento& entrada = buffer[sequencia & (CAPACIDADE - 1)];
+
+	entrada.sequencia.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	entrada.nome = nome;
+	entrada.categoria = categoria;
+	entrada.inicio = inicio;
+	entrada.duracao = duracao;
+	entrada.thread = Log::getThreadAtual();
+	entrada.argumento = argumento;
+
+	entrada.sequencia.store(sequencia + 1, std::memory_order_release);
+}
+
+void Rastreamento::nomearThread(const std::string& nome) {
+	unsigned int thread = Log::getThreadAtual();
+
+	if (thread >= MAXIMO_THREADS)
+		return;
+
+	std::lock_guard<std::mutex> trava(mutexThreads);
+	nomesThreads[thread] = nome;
+}
+
+bool Rastreamento::exportar(const std::string& caminho) {
+	FILE* arquivo = fopen(caminho.c_str(), "w");
+
+	if (arquivo == 0)
+		return false;
+
+	fprintf(arquivo, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	bool primeiro = true;
+
+	{
+		std::lock_guard<std::mutex> trava(mutexThreads);
+
+		for (unsigned int i = 0; i < MAXIMO_THREADS; i++) {
+			if (nomesThreads[i].empty())
+				continue;
+
+			fprintf(arquivo, "%s{\"name\":\"thread_name\",\"ph\":\"M\","
+					"\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+					primeiro ? "" : ",\n", i, nomesThreads[i].c_str());
+			primeiro = false;
+		}
+	}
+
+	EntradaRastreamento* buffer = entradas.load(std::memory_order_acquire);
+	unsigned long long fim = proximaEntrada.load(std::memory_order_acquire);
+	unsigned long long inicio = fim > CAPACIDADE ? fim - CAPACIDADE : 0;
+
+	for (unsigned long long s = inicio; buffer != 0 && s < fim; s++) {
+		EntradaRastreamento& entrada = buffer[s & (CAPACIDADE - 1)];
+
+		if (entrada.sequencia.load(std::memory_order_acquire) != s + 1)
+			continue;
+
+		EntradaRastreamento copia;
+		copia.nome = entrada.nome;
+		copia.categoria = entrada.categoria;
+		copia.inicio = entrada.inicio;
+		copia.duracao = entrada.duracao;
+		copia.thread = entrada.thread;
+		copia.argumento = entrada.argumento;
+
+		// Descartar o intervalo se foi sobrescrito durante a leitura
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if (entrada.sequencia.load(std::memory_order_relaxed) != s + 1)
+			continue;
+
+		fprintf(arquivo, "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\","
+				"\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u",
+				primeiro ? "" : ",\n", copia.nome, copia.categoria,
+				copia.inicio / 1e3, copia.duracao / 1e3, copia.thread);
+
+		if (copia.argumento >= 0)
+			fprintf(arquivo, ",\"args\":{\"indice\":%d}", copia.argumento);
+
+		fprintf(arquivo, "}");
+		primeiro = false;
+	}
+
+	fprintf(arquivo, "\n]}\n");
+
+	return fclose(arquivo) == 0;
+}